@@ -5,7 +5,8 @@ a = Analysis(
     ['C:\\Users\\hiepb\\IELTS-FORM\\ielts_form_tkinter.py'],
     pathex=[],
     binaries=[],
-    datas=[('C:\\Users\\hiepb\\IELTS-FORM\\ielts_icon.png', '.')],
+    datas=[('C:\\Users\\hiepb\\IELTS-FORM\\ielts_icon.png', '.'), ('C:\\Users\\hiepb\\IELTS-FORM\\bands', 'bands'),
+           ('C:\\Users\\hiepb\\IELTS-FORM\\templates', 'templates')],
     hiddenimports=[],
     hookspath=[],
     hooksconfig={},
@@ -0,0 +1,445 @@
+#!/usr/bin/env python3
+"""Benchmarks for parsing, grading, persistence, form list search and the Tkinter form build.
+
+    python3 ielts_bench.py                      run everything, compare with bench_baseline.json
+    python3 ielts_bench.py -k grading           only benchmarks whose name contains "grading"
+    python3 ielts_bench.py --tolerance 0.5      fail only when 50% slower than the baseline
+    python3 ielts_bench.py --update-baseline    record this machine's timings as the new baseline
+
+Each benchmark is timed as the best of --repeat runs (each run calls it
+enough times to last at least MIN_RUN_SECONDS) and reported per call. The
+exit status is 1 if any benchmark is slower than its baseline by more than
+the tolerance; a baseline entry may carry its own "tolerance" to override
+the command-line one for noisy cases.
+
+The baseline file keeps one set of timings per grading build, "native"
+(with the _ielts_native extension) and "python", and a run is only compared
+with the set for the build it uses; --update-baseline rewrites that set.
+
+The ui.* benchmarks need a display and are skipped without one; on a
+headless machine run them under Xvfb:
+
+    xvfb-run -a python3 ielts_bench.py -k ui.
+
+Baselines are machine-specific: refresh them with --update-baseline when
+moving to another machine, and compare timings from the same one.
+"""
+
+import argparse
+import json
+import os
+import random
+import sys
+import tempfile
+import time
+from typing import Callable, Dict, List, NamedTuple, Optional, Sequence
+
+from ielts_form_index import FormIndex
+from ielts_grading import HAVE_NATIVE, NUM_QUESTIONS, is_answer_correct, parse_answer_text
+from ielts_model import SectionModel
+from ielts_store import FormStore
+
+BASELINE_FILE = os.path.join(os.path.dirname(os.path.abspath(__file__)), "bench_baseline.json")
+DEFAULT_TOLERANCE = 0.25  # Allowed slowdown over the baseline, as a fraction
+MIN_RUN_SECONDS = 0.05
+LARGE_FORM_COUNT = 10000
+BUILD = "native" if HAVE_NATIVE else "python"  # Which baseline set this run is compared with
+
+# Databases written by the persistence benchmarks; removed when the run exits
+_scratch = tempfile.TemporaryDirectory(prefix="ielts-bench-")
+
+# A Listening key in the shape people paste it: headings, instructions,
+# single answers with alternatives and shared multiple-choice groups
+LISTENING_KEY = """Part 1
+Questions 1-10
+Write NO MORE THAN TWO WORDS AND/OR A NUMBER for each answer.
+1 Harrison
+2 (the) library
+3 15th May
+4 £20 / 20 pounds
+5 3 pm
+6 car park
+7 0207 946 0321
+8 colour
+9 Tuesday
+10 sandwiches
+Part 2
+Questions 11-20
+11 B
+12 C
+13 A
+14 G
+15 E
+16 F
+17 D
+18 B
+19&20 A, C
+Part 3
+21&22 B, E
+23&24&25 A, C, D
+26 F
+27 B
+28 H
+29 A
+30 G
+Part 4
+Write ONE WORD ONLY for each answer.
+31 vegetation
+32 insects
+33 soil
+34 temperature
+35 rainfall
+36 predators
+37 nests
+38 (the) coast
+39 migration
+40 energy
+"""
+
+# A typed sheet for LISTENING_KEY: most right, some misspelt, some blank
+LISTENING_ANSWERS = [
+    "harrison", "library", "may 15", "£20", "15:00", "carpark", "0207 946 0321", "color", "tuesday", "sandwich",
+    "B", "C", "A", "G", "E", "F", "D", "B", "C", "A",
+    "E", "B", "D", "A", "C", "F", "B", "", "A", "G",
+    "vegetation", "insect", "soil", "temprature", "rainfall", "predators", "", "coast", "migration", "energy",
+]
+
+
+class Benchmark(NamedTuple):
+    name: str
+    description: str
+    setup: Callable[[], Callable[[], object]]  # Returns the callable to time; setup itself is not timed
+    needs_display: bool
+
+
+BENCHMARKS: List[Benchmark] = []
+_teardowns: List[Callable[[], object]] = []  # Run after the current benchmark, e.g. to destroy its Tk root
+
+
+def benchmark(name: str, description: str, needs_display: bool = False):
+    def register(setup: Callable[[], Callable[[], object]]):
+        BENCHMARKS.append(Benchmark(name, description, setup, needs_display))
+        return setup
+    return register
+
+
+def time_call(func: Callable[[], object], repeat: int) -> float:
+    """Best seconds per call over repeat runs."""
+    number = 1
+    while True:
+        start = time.perf_counter()
+        for _ in range(number):
+            func()
+        elapsed = time.perf_counter() - start
+        if elapsed >= MIN_RUN_SECONDS or number >= 1 << 20:
+            break
+        number *= 2 if elapsed * 10 >= MIN_RUN_SECONDS else 10
+    best = elapsed / number
+    for _ in range(repeat - 1):
+        start = time.perf_counter()
+        for _ in range(number):
+            func()
+        best = min(best, (time.perf_counter() - start) / number)
+    return best
+
+
+def _large_key_text(question_total: int) -> str:
+    """A key with question_total single and shared questions, instructions every 100 lines."""
+    rng = random.Random(question_total)
+    lines = []
+    qnum = 1
+    while qnum <= question_total:
+        if qnum % 100 == 1:
+            lines.append(f"Part {qnum // 100 + 1}")
+            lines.append("Write NO MORE THAN THREE WORDS for each answer.")
+        if qnum + 1 <= question_total and rng.random() < 0.1:
+            lines.append(f"{qnum}&{qnum + 1} {rng.choice('ABCDE')}, {rng.choice('FGH')}")
+            qnum += 2
+            continue
+        lines.append(f"{qnum} (the) answer {qnum} / option {qnum}")
+        qnum += 1
+    return "\n".join(lines)
+
+
+def _filled_model() -> SectionModel:
+    model = SectionModel(NUM_QUESTIONS)
+    model.apply_answer_keys(*parse_answer_text(LISTENING_KEY))
+    for index, answer in enumerate(LISTENING_ANSWERS):
+        model.set_answer(index, answer)
+    return model
+
+
+def _sample_states(count: int) -> Dict[str, Dict]:
+    """Saved form states like FormWindow.save_state writes, for count Listening forms."""
+    base = _filled_model().to_state()
+    states = {}
+    for index in range(count):
+        state = dict(base)
+        state["user_answers"] = [answer if (index + qnum) % 5 else "" for qnum, answer in enumerate(base["user_answers"])]
+        state.update(score_text=f"Score: {index % 41}/40", answers_hidden=False, live_grading=index % 2 == 0,
+                     band_scheme="academic")
+        states[f"listening:Practice Test {index:05d}"] = state
+    return states
+
+
+@benchmark("parse.realistic", "parse_answer_text on a 40-question Listening key")
+def bench_parse_realistic():
+    return lambda: parse_answer_text(LISTENING_KEY)
+
+
+@benchmark("parse.large", "parse_answer_text on a 20,000-question key (~20k lines)")
+def bench_parse_large():
+    text = _large_key_text(20000)
+    return lambda: parse_answer_text(text, 20000)
+
+
+@benchmark("grading.is_answer_correct", "is_answer_correct over a 40-answer sheet")
+def bench_is_answer_correct():
+    mapping, _, _ = parse_answer_text(LISTENING_KEY)
+    pairs = [(answer, mapping.get(qnum, "")) for qnum, answer in enumerate(LISTENING_ANSWERS, start=1)]
+
+    def run():
+        for user_answer, key_answer in pairs:
+            is_answer_correct(user_answer, key_answer)
+    return run
+
+
+@benchmark("grading.evaluate", "SectionModel.evaluate (what SectionFrame.evaluate runs) on a 40-question sheet")
+def bench_evaluate():
+    model = _filled_model()
+    return model.evaluate
+
+
+@benchmark("grading.evaluate_live_edit", "One typed answer re-graded with live grading on")
+def bench_evaluate_live_edit():
+    model = _filled_model()
+    model.set_live_grading(True)
+    values = ["A", "C"]
+    state = {"turn": 0}
+
+    def run():
+        state["turn"] ^= 1
+        model.set_answer(22, values[state["turn"]])  # Question 23, in a three-question shared group
+    return run
+
+
+@benchmark("persistence.save_10k", f"StoreWriter's write of a save_database snapshot of {LARGE_FORM_COUNT:,} forms")
+def bench_save_states():
+    states = _sample_states(LARGE_FORM_COUNT)
+    names = [form_key.partition(":")[2] for form_key in states]
+    runs = {"count": 0}
+
+    def run():
+        runs["count"] += 1
+        path = os.path.join(_scratch.name, f"save{runs['count']}.sqlite3")
+        store = FormStore(path)
+        try:
+            store.apply_changes(states, {"listening": names})
+        finally:
+            store.close()
+        for suffix in ("", "-wal", "-shm"):
+            if os.path.exists(path + suffix):
+                os.remove(path + suffix)
+    return run
+
+
+@benchmark("persistence.load_10k", f"Store reads behind load_database for {LARGE_FORM_COUNT:,} forms")
+def bench_load_states():
+    states = _sample_states(LARGE_FORM_COUNT)
+    path = os.path.join(_scratch.name, "load.sqlite3")
+    store = FormStore(path)
+    for form_key, state in states.items():
+        store.put_state(form_key, state)
+    store.set_forms("listening", [form_key.partition(":")[2] for form_key in states])
+    store.close()
+
+    def run():
+        reader = FormStore(path)
+        try:
+            reader.load_states()
+            reader.load_forms("listening")
+        finally:
+            reader.close()
+    return run
+
+
+@benchmark("forms.search_10k", f"Form list searches (type-ahead) over {LARGE_FORM_COUNT:,} forms")
+def bench_form_search():
+    names = [f"Practice Cam {index // 8 + 1} {('Listening', 'Reading')[index % 2]} Test {index % 4 + 1:02d}"
+             for index in range(LARGE_FORM_COUNT)]
+    index = FormIndex(names)
+    queries = ["c", "ca", "cam", "cam 1", "cam 12", "cam 12 r", "test 1", "listening test 0"]
+
+    def run():
+        for query in queries:
+            index.search(query)
+    return run
+
+
+def _tk_root():
+    import tkinter as tk
+    root = tk.Tk()
+    root.withdraw()
+    _teardowns.append(root.destroy)
+    return root
+
+
+@benchmark("ui.build_groups", "SectionFrame._build_groups for the Reading layout", needs_display=True)
+def bench_build_groups():
+    from ielts_form_tkinter import SectionFrame
+    from ielts_templates import get_template
+    root = _tk_root()
+    groups = get_template("reading").groups
+    frame = SectionFrame(root, "Reading", groups)
+    frame.pack(fill="both", expand=True)
+
+    def run():
+        frame.set_groups(groups)
+        root.update_idletasks()
+    return run
+
+
+@benchmark("ui.section_evaluate", "SectionFrame.evaluate including the status redraw", needs_display=True)
+def bench_section_evaluate():
+    from ielts_form_tkinter import SectionFrame
+    from ielts_templates import get_template
+    root = _tk_root()
+    frame = SectionFrame(root, "Listening", get_template("listening").groups)
+    frame.pack(fill="both", expand=True)
+    frame.apply_answer_keys(*parse_answer_text(LISTENING_KEY))
+    for index, answer in enumerate(LISTENING_ANSWERS):
+        frame.model.set_answer(index, answer)
+    root.update_idletasks()
+
+    def run():
+        frame.reset_feedback()
+        frame.evaluate()
+        root.update_idletasks()
+    return run
+
+
+@benchmark("ui.form_window_open", "Open and close a Listening FormWindow", needs_display=True)
+def bench_form_window_open():
+    from ielts_form_tkinter import FormWindow
+    from ielts_templates import get_template
+    root = _tk_root()
+    template = get_template("listening")
+
+    def run():
+        form_window = FormWindow(root, "Benchmark", template)
+        form_window.window.update_idletasks()
+        form_window.window.destroy()
+        root.update()
+    return run
+
+
+def has_display() -> bool:
+    if sys.platform in ("win32", "darwin"):
+        return True
+    return bool(os.environ.get("DISPLAY") or os.environ.get("WAYLAND_DISPLAY"))
+
+
+def load_baselines(path: str) -> Dict[str, Dict[str, Dict]]:
+    """Every baseline set in the file, by build ("native", "python")."""
+    try:
+        with open(path, "r", encoding="utf-8") as handle:
+            return json.load(handle)
+    except FileNotFoundError:
+        return {}
+    except (OSError, json.JSONDecodeError) as e:
+        print(f"Warning: Could not read baseline {path}: {e}", file=sys.stderr)
+        return {}
+
+
+def save_baseline(path: str, results: Dict[str, float], baselines: Dict[str, Dict[str, Dict]]) -> None:
+    """Write results into this build's baseline set, keeping per-entry tolerances and the other build's set."""
+    entries = dict(baselines.get(BUILD, {}))
+    for name, seconds in results.items():
+        entry = dict(entries.get(name, {}))
+        entry["seconds"] = seconds
+        entries[name] = entry
+    baselines = dict(baselines)
+    baselines[BUILD] = dict(sorted(entries.items()))
+    with open(path, "w", encoding="utf-8") as handle:
+        json.dump(dict(sorted(baselines.items())), handle, indent=2)
+        handle.write("\n")
+
+
+def format_seconds(seconds: float) -> str:
+    for unit, scale in (("s", 1.0), ("ms", 1e-3), ("us", 1e-6)):
+        if seconds >= scale:
+            return f"{seconds / scale:.2f} {unit}"
+    return f"{seconds / 1e-9:.0f} ns"
+
+
+def run(names: Sequence[str], repeat: int, tolerance: float, baseline: Dict[str, Dict]) -> Dict[str, float]:
+    """Time the selected benchmarks and print one line each; returns seconds per call by name."""
+    results: Dict[str, float] = {}
+    display = has_display()
+    for bench in BENCHMARKS:
+        if bench.name not in names:
+            continue
+        if bench.needs_display and not display:
+            print(f"{bench.name:<28} skipped (no display; run under xvfb-run)")
+            continue
+        try:
+            seconds = time_call(bench.setup(), repeat)
+        finally:
+            while _teardowns:
+                _teardowns.pop()()
+        results[bench.name] = seconds
+        line = f"{bench.name:<28} {format_seconds(seconds):>10}"
+        entry = baseline.get(bench.name)
+        if entry:
+            ratio = seconds / entry["seconds"]
+            limit = 1.0 + entry.get("tolerance", tolerance)
+            verdict = "REGRESSION" if ratio > limit else "ok"
+            line += f"  {ratio:5.2f}x baseline  {verdict}"
+        print(line, flush=True)
+    return results
+
+
+def regressions(results: Dict[str, float], baseline: Dict[str, Dict], tolerance: float) -> List[str]:
+    slow = []
+    for name, seconds in results.items():
+        entry = baseline.get(name)
+        if entry and seconds > entry["seconds"] * (1.0 + entry.get("tolerance", tolerance)):
+            slow.append(name)
+    return slow
+
+
+def main(argv: Optional[Sequence[str]] = None) -> int:
+    parser = argparse.ArgumentParser(prog="ielts_bench", description="IELTS answer form benchmarks.")
+    parser.add_argument("-k", dest="pattern", default="", help="Only run benchmarks whose name contains this.")
+    parser.add_argument("--repeat", type=int, default=5, help="Timed runs per benchmark (default: 5).")
+    parser.add_argument("--tolerance", type=float, default=DEFAULT_TOLERANCE,
+                        help=f"Allowed slowdown over the baseline as a fraction (default: {DEFAULT_TOLERANCE}).")
+    parser.add_argument("--baseline", default=BASELINE_FILE, help="Baseline file (default: bench_baseline.json).")
+    parser.add_argument("--update-baseline", action="store_true", help="Write this run's timings to the baseline.")
+    parser.add_argument("--list", action="store_true", help="List the benchmarks and exit.")
+    args = parser.parse_args(argv)
+
+    selected = [bench.name for bench in BENCHMARKS if args.pattern in bench.name]
+    if args.list:
+        for bench in BENCHMARKS:
+            if bench.name in selected:
+                print(f"{bench.name:<28} {bench.description}")
+        return 0
+
+    baselines = load_baselines(args.baseline)
+    baseline = baselines.get(BUILD, {})
+    print(f"Grading build: {BUILD} (compared with the {BUILD!r} baseline)")
+    results = run(selected, max(1, args.repeat), args.tolerance, {} if args.update_baseline else baseline)
+    if args.update_baseline:
+        save_baseline(args.baseline, results, baselines)
+        print(f"{BUILD!r} baseline written to {args.baseline}")
+        return 0
+    slow = regressions(results, baseline, args.tolerance)
+    if slow:
+        print(f"{len(slow)} benchmark(s) slower than the baseline: {', '.join(slow)}", file=sys.stderr)
+        return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
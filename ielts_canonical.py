@@ -0,0 +1,310 @@
+#!/usr/bin/env python3
+"""Canonical spellings of answers for lenient matching (no tkinter dependency).
+
+canonicalize_answer rewrites the forms an examiner accepts as the same answer
+into one spelling:
+
+- number words: "fifteen", "twenty-five", "one hundred and five" -> 15, 25, 105
+- ordinals and dates: "twenty-first" -> 21st; "15th May", "the fifteenth of May", "May 15" -> may 15
+- times: "3 pm", "3.00 p.m.", "15:00" -> 15:00; "3 o'clock" -> 3:00
+- currency: "£20", "£20.00", "20 quid" -> £20; "50p", "50 pence" -> 50p
+- British/American spelling: "colour", "centre", "organise" -> color, center, organize
+
+A bare "3.30" may be a time or a decimal, and "20 pounds" money or a weight,
+so canonicalize_answer leaves both alone. key_spellings adds them for keys
+that are a time or an amount of money: "3:30" also accepts "3.30", and "£20"
+also accepts "20 pounds".
+
+ielts_grading applies both once to every key when the key is compiled, and
+canonicalize_answer to a user answer only when the answer did not match as
+typed. All tables and patterns are built once at import.
+"""
+
+import re
+from functools import lru_cache
+from typing import Dict, List, Optional, Tuple
+
+UNITS: Dict[str, int] = {
+    word: value
+    for value, word in enumerate(
+        "zero one two three four five six seven eight nine ten eleven twelve thirteen "
+        "fourteen fifteen sixteen seventeen eighteen nineteen".split()
+    )
+}
+TENS: Dict[str, int] = {
+    word: value * 10
+    for value, word in enumerate("twenty thirty forty fifty sixty seventy eighty ninety".split(), start=2)
+}
+SCALES: Dict[str, int] = {"hundred": 100, "thousand": 1000, "million": 1000000}
+ORDINAL_WORDS: Dict[str, int] = {
+    "first": 1, "second": 2, "third": 3, "fourth": 4, "fifth": 5, "sixth": 6, "seventh": 7,
+    "eighth": 8, "ninth": 9, "tenth": 10, "eleventh": 11, "twelfth": 12, "thirteenth": 13,
+    "fourteenth": 14, "fifteenth": 15, "sixteenth": 16, "seventeenth": 17, "eighteenth": 18,
+    "nineteenth": 19, "twentieth": 20, "thirtieth": 30, "fortieth": 40, "fiftieth": 50,
+    "sixtieth": 60, "seventieth": 70, "eightieth": 80, "ninetieth": 90, "hundredth": 100,
+    "thousandth": 1000,
+}
+NUMBER_WORDS = set(UNITS) | set(TENS) | set(SCALES) | set(ORDINAL_WORDS)
+ORDINAL_SUFFIXES = {"st", "nd", "rd", "th"}
+
+MONTHS: Dict[str, str] = {}
+for _month in ("january february march april may june july august september october "
+               "november december").split():
+    MONTHS[_month] = _month
+    MONTHS[_month[:3]] = _month
+MONTHS["sept"] = "september"
+
+# Currency symbol -> words that name it after the amount
+CURRENCY_WORDS: Dict[str, str] = {
+    "quid": "£",  # Not "pounds", which is also a weight (see key_spellings)
+    "dollar": "$", "dollars": "$",
+    "euro": "€", "euros": "€",
+}
+CURRENCY_SYMBOLS = set(CURRENCY_WORDS.values())
+PENCE_WORDS = {"p", "pence", "penny"}
+NAMED_TIMES = {"noon": "12:00", "midday": "12:00", "midnight": "0:00"}
+POUND_WORDS = ("pounds", "pound")  # How a "£" amount in a key may also be written
+
+# British spelling -> American; plurals and common inflections are added below
+_SPELLINGS = """
+colour color  favour favor  favourite favorite  flavour flavor  harbour harbor
+honour honor  humour humor  labour labor  neighbour neighbor  neighbourhood neighborhood
+behaviour behavior  rumour rumor  vapour vapor  odour odor  armour armor  parlour parlor
+centre center  theatre theater  metre meter  litre liter  fibre fiber  kilometre kilometer
+centimetre centimeter  millimetre millimeter  calibre caliber  spectre specter
+programme program  catalogue catalog  dialogue dialog  analogue analog  monologue monolog
+organise organize  organisation organization  recognise recognize  realise realize
+apologise apologize  specialise specialize  emphasise emphasize
+criticise criticize  memorise memorize  summarise summarize  minimise minimize
+maximise maximize  prioritise prioritize  utilise utilize  standardise standardize
+analyse analyze  paralyse paralyze  catalyse catalyze
+defence defense  licence license  offence offense  pretence pretense
+travelled traveled  travelling traveling  traveller traveler  cancelled canceled
+cancelling canceling  labelled labeled  modelling modeling  jewellery jewelry
+counselling counseling  fuelled fueled
+grey gray  tyre tire  kerb curb  cheque check  plough plow  mould mold  aluminium aluminum
+enrolment enrollment  fulfil fulfill  skilful skillful  instalment installment
+ageing aging  judgement judgment  acknowledgement acknowledgment
+pyjamas pajamas  aeroplane airplane  draught draft  manoeuvre maneuver
+oestrogen estrogen  paediatric pediatric  encyclopaedia encyclopedia  anaemia anemia
+"""
+SPELLINGS: Dict[str, str] = {}
+for _british, _american in zip(*[iter(_SPELLINGS.split())] * 2):
+    SPELLINGS[_british] = _american
+    SPELLINGS[_british + "s"] = _american + "s"
+    if _british.endswith("ise"):
+        for _ending in ("ised", "ises", "ising"):
+            SPELLINGS[_british[:-3] + _ending] = _american[:-3] + _ending.replace("s", "z", 1)
+    elif _british.endswith("our"):
+        SPELLINGS[_british + "ed"] = _american + "ed"
+        SPELLINGS[_british + "ing"] = _american + "ing"
+
+AM_PM_RE = re.compile(r"(?<![^\W\d_])([ap])\.?\s?m\b\.?")  # "p.m.", "p.m", "pm" after a number or space
+TOKEN_RE = re.compile(r"\d{1,3}(?:,\d{3})+(?:\.\d+)?|\d+(?:[.:]\d+)?|[^\W\d_]+|\S")
+CLOCK_TOKEN_RE = re.compile(r"^(\d{1,2}):(\d\d)$")  # A canonical time, "15:30"
+POUNDS_TOKEN_RE = re.compile(r"^£(\d[\d.]*)$")  # A canonical amount in pounds, "£20"
+
+
+def _read_number(tokens: List[str], start: int) -> Tuple[Optional[str], bool, int]:
+    """Read a number at tokens[start]: (digits, is_ordinal, index after it), or (None, False, start).
+
+    Digits keep a decimal point or colon as written ("3.30", "15:00");
+    canonicalize_answer decides whether they are a clock time. Number words
+    are read as one number only where they combine in English ("twenty-five",
+    "one hundred and five", "two thousand"), so "five six" is read as 5 and
+    then 6, not 11.
+    """
+    token = tokens[start]
+    if token[0].isdecimal():
+        end = start + 1
+        ordinal = end < len(tokens) and tokens[end] in ORDINAL_SUFFIXES and "." not in token and ":" not in token
+        if ordinal:
+            end += 1
+        return token.replace(",", ""), ordinal, end
+    if token not in NUMBER_WORDS or token in SCALES:
+        return None, False, start
+
+    total = 0
+    current = 0  # The part below the last thousand/million
+    last = ""  # Kind of the previous word: "", "zero", "unit", "tens", "tens-unit", "hundred" or "scale"
+    scale_limit = SCALES["million"] * 1000  # Each thousand/million must be smaller than the one before
+    index = start
+    ordinal = False
+    while index < len(tokens):
+        word = tokens[index]
+        after_hundreds = last in ("", "hundred", "scale")
+        if word == "and" and last in ("hundred", "scale") and index + 1 < len(tokens):
+            following = tokens[index + 1]
+            if (1 <= UNITS.get(following, 0) or following in TENS
+                    or ORDINAL_WORDS.get(following, 100) < 100):
+                index += 1  # "one hundred and five"
+                continue
+            break
+        if word in UNITS:
+            value = UNITS[word]
+            if value == 0:
+                if last:
+                    break
+                last = "zero"
+            elif after_hundreds:
+                current += value
+                last = "unit"
+            elif last == "tens" and value < 10:
+                current += value  # "twenty-five"
+                last = "tens-unit"
+            else:
+                break
+        elif word in TENS:
+            if not after_hundreds:
+                break
+            current += TENS[word]
+            last = "tens"
+        elif word in ORDINAL_WORDS:
+            value = ORDINAL_WORDS[word]
+            if value == 100:
+                if last not in ("", "unit"):
+                    break
+                current = (current or 1) * value
+            elif value == 1000:
+                if last in ("zero", "scale"):
+                    break
+                current = (current or 1) * value
+            elif after_hundreds or (last == "tens" and value < 10):
+                current += value
+            else:
+                break
+            ordinal = True
+            index += 1
+            break
+        elif word == "hundred":
+            # "five hundred", "fifteen hundred"; not "one hundred five hundred"
+            if last != "unit" or current >= 20:
+                break
+            current *= 100
+            last = "hundred"
+        elif word in SCALES:
+            if last in ("", "zero", "scale") or SCALES[word] >= scale_limit:
+                break
+            scale_limit = SCALES[word]
+            total += current * SCALES[word]
+            current = 0
+            last = "scale"
+        else:
+            break
+        index += 1
+    return str(total + current), ordinal, index
+
+
+def _time(number: str, meridiem: str = "") -> Optional[str]:
+    """"3" / "3.30" / "3:30" (+ "am"/"pm") as "h:mm", or None if it is not a clock time."""
+    hours_text, _, minutes_text = number.replace(".", ":").partition(":")
+    hours = int(hours_text)
+    minutes = int(minutes_text) if minutes_text else 0
+    if len(minutes_text) not in (0, 2) or minutes > 59 or hours > 24 or (meridiem and not 1 <= hours <= 12):
+        return None
+    if meridiem == "pm" and hours < 12:
+        hours += 12
+    elif meridiem == "am" and hours == 12:
+        hours = 0
+    return f"{hours}:{minutes:02d}"
+
+
+def _amount(number: str) -> str:
+    """Drop zero pence/cents: "20.00" -> "20"."""
+    whole, dot, fraction = number.partition(".")
+    return whole if dot and not fraction.strip("0") else number
+
+
+def _ordinal(number: str) -> str:
+    """"21" -> "21st", "12" -> "12th"."""
+    if number[-2:] in ("11", "12", "13"):
+        return number + "th"
+    return number + {"1": "st", "2": "nd", "3": "rd"}.get(number[-1], "th")
+
+
+def _day(number: str) -> Optional[int]:
+    return int(number) if number.isdecimal() and 1 <= int(number) <= 31 else None
+
+
+@lru_cache(maxsize=65536)
+def canonicalize_answer(answer: str) -> str:
+    """Rewrite an answer into its canonical spelling, words separated by single spaces.
+
+    Text the tables do not cover is kept (lower-cased), so the result still
+    needs normalize_answer before it is compared.
+    """
+    text = AM_PM_RE.sub(r" \1m", answer.lower().replace("-", " ").replace("o'clock", " oclock"))
+    tokens = TOKEN_RE.findall(text)
+    out: List[str] = []
+    index = 0
+    while index < len(tokens):
+        token = tokens[index]
+
+        if token in CURRENCY_SYMBOLS and index + 1 < len(tokens) and tokens[index + 1][0].isdecimal():
+            out.append(token + _amount(tokens[index + 1].replace(",", "")))
+            index += 2
+            continue
+
+        if token in MONTHS:
+            # "May 15", "May the 15th", "May fifteenth"
+            day_start = index + 2 if index + 2 < len(tokens) and tokens[index + 1] == "the" else index + 1
+            if day_start < len(tokens):
+                number, _, end = _read_number(tokens, day_start)
+                day = _day(number) if number is not None else None
+                if day is not None:
+                    out.append(f"{MONTHS[token]} {day}")
+                    index = end
+                    continue
+            out.append(MONTHS[token])
+            index += 1
+            continue
+
+        number, ordinal, end = _read_number(tokens, index)
+        if number is None:
+            out.append(NAMED_TIMES.get(token) or SPELLINGS.get(token, token))
+            index += 1
+            continue
+
+        following = tokens[end] if end < len(tokens) else ""
+        month_at = end + 1 if following == "of" else end
+        month = tokens[month_at] if month_at < len(tokens) else ""
+        if month in MONTHS and _day(number) is not None:
+            if out and out[-1] == "the":
+                out.pop()  # "the 15th of May"
+            out.append(f"{MONTHS[month]} {int(number)}")
+            index = month_at + 1
+            continue
+        if following in ("am", "pm", "oclock") or ":" in number:
+            # A bare "3.30" is left as a number; key_spellings covers keys that are times
+            clock = _time(number, following if following != "oclock" else "")
+            if clock is not None:
+                out.append(clock)
+                index = end + 1 if following in ("am", "pm", "oclock") else end
+                continue
+        if following in CURRENCY_WORDS and not ordinal:
+            out.append(CURRENCY_WORDS[following] + _amount(number))
+            index = end + 1
+            continue
+        if following in PENCE_WORDS and number.isdecimal():
+            out.append(number + "p")
+            index = end + 1
+            continue
+        out.append(_ordinal(number) if ordinal else number)
+        index = end
+    return " ".join(out)
+
+
+def key_spellings(canonical: str) -> List[str]:
+    """Other spellings of a canonicalized key that only mean the same because the key says so.
+
+    A key holding a time ("15:30") also accepts it with a dot ("15.30"), and
+    a key holding an amount in pounds ("£20") also accepts "20 pounds".
+    """
+    tokens = canonical.split()
+    times = [CLOCK_TOKEN_RE.sub(r"\1.\2", token) for token in tokens]
+    spellings = [" ".join(times)] if times != tokens else []
+    for word in POUND_WORDS:
+        money = [POUNDS_TOKEN_RE.sub(rf"\1 {word}", token) for token in times]
+        if money != times:
+            spellings.append(" ".join(money))
+    return spellings
@@ -0,0 +1,250 @@
+#!/usr/bin/env python3
+"""Command-line tools for the IELTS answer form (no tkinter required).
+
+    python3 ielts_cli.py grade KEY_FILE PATH [PATH ...] [--format csv|jsonl]
+    python3 ielts_cli.py import-keys DIRECTORY [--db PATH]
+    python3 ielts_cli.py history FORM_KEY [--attempt N] [--db PATH]
+
+PATH may be an answer file written by "Save Answers", a directory of them,
+or a glob pattern. Sheets are streamed through a process pool and one line
+per sheet is written as they are graded.
+
+import-keys loads a folder of key files (named like "Cam 10 Listening
+Test 1.txt") into the app's key library, so forms pick up their keys on open.
+
+history lists the submitted attempts at a form (e.g. "listening:Practice
+Cam 10 Listening Test 01"), or prints one attempt's answers as JSON.
+"""
+
+import argparse
+import csv
+import glob
+import json
+import os
+import sys
+from multiprocessing import Pool
+from typing import Dict, Iterable, Iterator, List, Optional, Sequence, Tuple
+
+from ielts_grading import BAND_SCHEMES, NUM_QUESTIONS, CompiledKey, compile_answer_text, lookup_band
+from ielts_store import FORMS_SQLITE_FILE, FormStore
+from ielts_templates import all_templates, template_for_title
+
+RESULT_FIELDS = ["file", "form", "section", "correct", "evaluated", "total", "band", "error"]
+
+# Compiled once per worker process by _init_worker
+_worker_key: Optional[CompiledKey] = None
+_worker_section: Optional[str] = None
+_worker_scheme: Optional[str] = None
+
+
+def parse_answer_sheet(text: str) -> Tuple[str, str, List[str]]:
+    """Parse the format FormWindow.on_save_clicked writes.
+
+    Line 1 is the form name, line 2 the section, then one "N,answer" line per
+    question. Returns (form_name, section_name, answers); the section's test
+    template sets the number of answers (NUM_QUESTIONS if it has none).
+    """
+    lines = text.splitlines()
+    form_name = lines[0].strip() if lines else ""
+    section_name = lines[1].strip() if len(lines) > 1 else ""
+    template = template_for_title(section_name)
+    question_total = template.question_total if template else NUM_QUESTIONS
+    answers = [""] * question_total
+    for line in lines[2:]:
+        number, sep, answer = line.partition(",")
+        if not sep:
+            continue
+        try:
+            qnum = int(number)
+        except ValueError:
+            continue
+        if 1 <= qnum <= question_total:
+            answers[qnum - 1] = answer.strip()
+    return form_name, section_name, answers
+
+
+def iter_sheet_paths(patterns: Sequence[str]) -> Iterator[str]:
+    """Yield answer files from files, directories (*.txt, recursive) and glob patterns."""
+    for pattern in patterns:
+        if os.path.isdir(pattern):
+            for dirpath, dirnames, filenames in os.walk(pattern):
+                dirnames.sort()
+                for filename in sorted(filenames):
+                    if filename.lower().endswith(".txt"):
+                        yield os.path.join(dirpath, filename)
+        elif os.path.isfile(pattern):
+            yield pattern
+        else:
+            yield from glob.iglob(pattern, recursive=True)
+
+
+def grade_sheet(path: str, key: CompiledKey, section_override: Optional[str] = None,
+                band_scheme: Optional[str] = None) -> Dict:
+    """Grade one saved answer file; errors are reported in the result instead of raised."""
+    result: Dict = {field: "" for field in RESULT_FIELDS}
+    result["file"] = path
+    try:
+        with open(path, "r", encoding="utf-8") as handle:
+            form_name, section_name, answers = parse_answer_sheet(handle.read())
+    except (OSError, UnicodeDecodeError) as e:
+        result["error"] = str(e)
+        return result
+
+    section_name = section_override or section_name
+    _, correct, evaluated = key.grade(answers)
+    # Templates without a band section (drills, quizzes) get no band
+    template = template_for_title(section_name)
+    band_section = template.band_section if template else section_name
+    if template and not band_scheme:
+        band_scheme = template.band_scheme
+    result.update(
+        form=form_name,
+        section=section_name,
+        correct=correct,
+        evaluated=evaluated,
+        total=len(answers),
+        band=lookup_band(band_section, correct, band_scheme) if evaluated and band_section else "",
+    )
+    return result
+
+
+def _init_worker(key: CompiledKey, section_override: Optional[str], band_scheme: Optional[str]) -> None:
+    global _worker_key, _worker_section, _worker_scheme
+    _worker_key = key
+    _worker_section = section_override
+    _worker_scheme = band_scheme
+
+
+def _grade_in_worker(path: str) -> Dict:
+    assert _worker_key is not None
+    return grade_sheet(path, _worker_key, _worker_section, _worker_scheme)
+
+
+def grade_paths(key: CompiledKey, paths: Iterable[str], workers: int = 1,
+                section_override: Optional[str] = None, chunksize: int = 64,
+                band_scheme: Optional[str] = None) -> Iterator[Dict]:
+    """Grade sheets in input order, in-process for one worker or through a pool."""
+    if workers <= 1:
+        for path in paths:
+            yield grade_sheet(path, key, section_override, band_scheme)
+        return
+
+    with Pool(workers, initializer=_init_worker, initargs=(key, section_override, band_scheme)) as pool:
+        yield from pool.imap(_grade_in_worker, paths, chunksize=chunksize)
+
+
+def cmd_grade(args: argparse.Namespace) -> int:
+    try:
+        with open(args.key_file, "r", encoding="utf-8") as handle:
+            key_text = handle.read()
+    except OSError as e:
+        print(f"Error: could not read key file: {e}", file=sys.stderr)
+        return 2
+    template = template_for_title(args.section) if args.section else None
+    key = compile_answer_text(key_text, template.question_total if template else NUM_QUESTIONS)
+    if not any(key.keys):
+        print(f"Error: no answers detected in {args.key_file}", file=sys.stderr)
+        return 2
+
+    out = open(args.output, "w", encoding="utf-8", newline="") if args.output else sys.stdout
+    failures = 0
+    try:
+        writer = None
+        if args.format == "csv":
+            writer = csv.DictWriter(out, fieldnames=RESULT_FIELDS)
+            writer.writeheader()
+        results = grade_paths(key, iter_sheet_paths(args.paths), args.workers, args.section,
+                              band_scheme=args.scheme)
+        for result in results:
+            if result["error"]:
+                failures += 1
+            if writer is not None:
+                writer.writerow(result)
+            else:
+                out.write(json.dumps(result, ensure_ascii=False) + "\n")
+    finally:
+        if out is not sys.stdout:
+            out.close()
+    return 1 if failures else 0
+
+
+def cmd_import_keys(args: argparse.Namespace) -> int:
+    if not os.path.isdir(args.directory):
+        print(f"Error: not a directory: {args.directory}", file=sys.stderr)
+        return 2
+    db_path = args.db or FORMS_SQLITE_FILE
+    os.makedirs(os.path.dirname(os.path.abspath(db_path)), exist_ok=True)
+    store = FormStore(db_path)
+    try:
+        imported, skipped = store.key_library.import_directory(args.directory)
+        total = store.key_library.count()
+    finally:
+        store.close()
+    for path in skipped:
+        print(f"Skipped (no Cam/section/test in name or no answers): {path}", file=sys.stderr)
+    print(f"Imported {imported} key(s); library now holds {total}.")
+    return 1 if skipped else 0
+
+
+def cmd_history(args: argparse.Namespace) -> int:
+    db_path = args.db or FORMS_SQLITE_FILE
+    if not os.path.exists(db_path):
+        print(f"Error: no form database at {db_path}", file=sys.stderr)
+        return 2
+    store = FormStore(db_path)
+    try:
+        if args.attempt is not None:
+            state = store.get_attempt(args.form_key, args.attempt)
+            if state is None:
+                print(f"Error: {args.form_key} has no attempt {args.attempt}", file=sys.stderr)
+                return 1
+            print(json.dumps(state, ensure_ascii=False, indent=2))
+            return 0
+        attempts = store.list_attempts(args.form_key)
+    finally:
+        store.close()
+    if not attempts:
+        print(f"No attempts recorded for {args.form_key}.")
+        return 1
+    for number, submitted_at, correct, evaluated in attempts:
+        print(f"{number:>4}  {submitted_at}  {correct}/{evaluated}")
+    return 0
+
+
+def build_parser() -> argparse.ArgumentParser:
+    parser = argparse.ArgumentParser(prog="ielts-form", description="IELTS answer form tools.")
+    subparsers = parser.add_subparsers(dest="command", required=True)
+
+    grade = subparsers.add_parser("grade", help="Grade saved answer files against a key file.")
+    grade.add_argument("key_file", help="Answer key in the same format as 'Paste Right Answer'.")
+    grade.add_argument("paths", nargs="+", help="Answer files, directories or glob patterns.")
+    grade.add_argument("--format", choices=["csv", "jsonl"], default="csv", help="Output format (default: csv).")
+    grade.add_argument("--output", "-o", help="Write results here instead of stdout.")
+    grade.add_argument("--workers", "-j", type=int, default=os.cpu_count() or 1,
+                       help="Worker processes (default: CPU count, 1 = no pool).")
+    grade.add_argument("--section", choices=[template.title for template in all_templates()],
+                       help="Test template (and band table) to use instead of the section named in each file.")
+    grade.add_argument("--scheme", choices=list(BAND_SCHEMES), default=None,
+                       help="Band conversion: academic (default) or general (General Training Reading).")
+    grade.set_defaults(func=cmd_grade)
+
+    import_keys = subparsers.add_parser("import-keys", help="Import a folder of answer key files into the key library.")
+    import_keys.add_argument("directory", help="Folder of *.txt key files (searched recursively).")
+    import_keys.add_argument("--db", help=f"Form database to import into (default: {FORMS_SQLITE_FILE}).")
+    import_keys.set_defaults(func=cmd_import_keys)
+
+    history = subparsers.add_parser("history", help="List a form's submitted attempts, or show one of them.")
+    history.add_argument("form_key", help='Section and form name, e.g. "listening:Practice Cam 10 Listening Test 01".')
+    history.add_argument("--attempt", type=int, help="Print this attempt's saved answers and keys as JSON.")
+    history.add_argument("--db", help=f"Form database to read (default: {FORMS_SQLITE_FILE}).")
+    history.set_defaults(func=cmd_history)
+    return parser
+
+
+def main(argv: Optional[Sequence[str]] = None) -> int:
+    args = build_parser().parse_args(argv)
+    return args.func(args)
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,148 @@
+#!/usr/bin/env python3
+"""Searchable index of one section's form list (no tkinter dependency).
+
+FormIndex keeps the forms in list order with constant-time membership, a
+sorted index of the words in every name for type-ahead filtering, and each
+form's status with running totals. The status of a form is updated when its
+saved state changes, so the list never re-reads every state to redraw.
+
+A search such as "cam 12 te" keeps the forms having, for every query word,
+a word starting with it ("Practice Cam 12 Reading Test 03"). Numbers are
+compared without leading zeros, so "test 3" finds "Test 03".
+"""
+
+import re
+from bisect import bisect_left, bisect_right
+from typing import Dict, Iterable, List, Optional, Set, Tuple
+
+STATUS_NOT_STARTED = "not-started"
+STATUS_IN_PROGRESS = "in-progress"
+STATUS_COMPLETED = "completed"
+STATUSES = (STATUS_NOT_STARTED, STATUS_IN_PROGRESS, STATUS_COMPLETED)
+
+WORD_RE = re.compile(r"[^\W_]+")
+
+
+def form_status(state: Optional[Dict]) -> str:
+    """Status of a form from its saved state: submitted for a score, answered or keyed, or untouched."""
+    if state and state.get("score_text"):
+        return STATUS_COMPLETED
+    if state and (state.get("user_answers") or state.get("answer_keys")):
+        return STATUS_IN_PROGRESS
+    return STATUS_NOT_STARTED
+
+
+def _index_word(word: str) -> str:
+    word = word.lower()
+    return (word.lstrip("0") or "0") if word.isdecimal() else word
+
+
+def name_words(name: str) -> Tuple[str, ...]:
+    """Distinct index words of a form name or query, as search compares them."""
+    return tuple(dict.fromkeys(_index_word(word) for word in WORD_RE.findall(name)))
+
+
+class FormIndex:
+    """Ordered form names with a word-prefix search index and per-form status."""
+
+    def __init__(self, names: Iterable[str] = ()):
+        self._order: Dict[str, int] = {}  # Name -> sequence number; dict order is the list order
+        self._by_sequence: Dict[int, str] = {}
+        self._next = 0
+        # Every word of every name, sorted by (word, sequence), as two parallel lists so a
+        # prefix's matches are one slice of _word_sequences
+        self._word_keys: List[str] = []
+        self._word_sequences: List[int] = []
+        self._status: Dict[str, str] = {}
+        self.counts: Dict[str, int] = {status: 0 for status in STATUSES}
+        self.add_many(names)
+
+    def __len__(self) -> int:
+        return len(self._order)
+
+    def __contains__(self, name: object) -> bool:
+        return name in self._order
+
+    def names(self) -> List[str]:
+        return list(self._order)
+
+    def add(self, name: str, status: str = STATUS_NOT_STARTED) -> bool:
+        """Append a form; returns False if it is already listed."""
+        if name in self._order:
+            return False
+        sequence = self._register(name, status)
+        for word in name_words(name):
+            # The newest sequence number sorts last among equal words
+            position = bisect_right(self._word_keys, word)
+            self._word_keys.insert(position, word)
+            self._word_sequences.insert(position, sequence)
+        return True
+
+    def add_many(self, names: Iterable[str], statuses: Optional[Dict[str, str]] = None) -> int:
+        """Append forms not listed yet and re-sort the word index once. Returns how many were added."""
+        added = []
+        for name in names:
+            if name not in self._order:
+                added.append((name, self._register(name, (statuses or {}).get(name, STATUS_NOT_STARTED))))
+        if added:
+            entries = list(zip(self._word_keys, self._word_sequences))
+            entries.extend((word, sequence) for name, sequence in added for word in name_words(name))
+            entries.sort()
+            self._word_keys = [word for word, _ in entries]
+            self._word_sequences = [sequence for _, sequence in entries]
+        return len(added)
+
+    def _register(self, name: str, status: str) -> int:
+        sequence = self._next
+        self._next += 1
+        self._order[name] = sequence
+        self._by_sequence[sequence] = name
+        self._status[name] = status
+        self.counts[status] += 1
+        return sequence
+
+    def remove(self, name: str) -> bool:
+        sequence = self._order.pop(name, None)
+        if sequence is None:
+            return False
+        del self._by_sequence[sequence]
+        for word in name_words(name):
+            start = bisect_left(self._word_keys, word)
+            position = self._word_sequences.index(sequence, start, bisect_right(self._word_keys, word))
+            del self._word_keys[position]
+            del self._word_sequences[position]
+        self.counts[self._status.pop(name)] -= 1
+        return True
+
+    def status(self, name: str) -> str:
+        return self._status.get(name, STATUS_NOT_STARTED)
+
+    def set_status(self, name: str, status: str) -> bool:
+        """Record a listed form's status. Returns True if it changed."""
+        old = self._status.get(name)
+        if old is None or old == status:
+            return False
+        self._status[name] = status
+        self.counts[old] -= 1
+        self.counts[status] += 1
+        return True
+
+    def _prefix_matches(self, prefix: str) -> Set[int]:
+        """Sequence numbers of the forms with a word starting with prefix."""
+        start = bisect_left(self._word_keys, prefix)
+        # Every word starting with prefix sorts below prefix + the highest code point
+        end = bisect_left(self._word_keys, prefix + "\U0010ffff", start)
+        return set(self._word_sequences[start:end])
+
+    def search(self, query: str) -> List[str]:
+        """Forms matching every word of query by word prefix, in list order (all forms for a blank query)."""
+        # Longest words first: they usually match the fewest names
+        prefixes = sorted(name_words(query), key=len, reverse=True)
+        if not prefixes:
+            return self.names()
+        found = self._prefix_matches(prefixes[0])
+        for prefix in prefixes[1:]:
+            if not found:
+                break
+            found &= self._prefix_matches(prefix)
+        return [self._by_sequence[sequence] for sequence in sorted(found)]
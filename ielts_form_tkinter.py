@@ -1,200 +1,68 @@
 #!/usr/bin/env python3
 """IELTS Answer Form implemented with tkinter (works on Windows, Linux, macOS)."""
 
+import time
+
+PROCESS_STARTED_AT = time.perf_counter()  # Taken before the other imports; start of the startup-time metric
+
 import os
 import re
 import json
-import sys
+import threading
 import tkinter as tk
 from tkinter import ttk, filedialog, messagebox, scrolledtext
-from typing import Dict, List, Optional, Sequence, Tuple
+from tkinter import font as tkfont
+from typing import Callable, Dict, List, Optional, Sequence, Set, Tuple
 from datetime import datetime, timedelta
 from pathlib import Path
 
-NUM_QUESTIONS = 40
+from ielts_store import (
+    FORMS_DB_FILE,
+    FORMS_JOURNAL_FILE,
+    FORMS_SQLITE_FILE,
+    USER_DATA_DIR,
+    Attempt,
+    EditJournal,
+    FormStore,
+    StoreWriter,
+)
+from ielts_form_index import STATUS_COMPLETED, STATUS_IN_PROGRESS, STATUS_NOT_STARTED, FormIndex, form_status
+from ielts_grading import CompiledKey, WordLimit, lookup_band, parse_answer_text
+from ielts_model import FIELD_ANSWER, FIELD_KEY, FIELD_SCORE, FIELD_VERDICT, SectionModel
+from ielts_templates import TestTemplate, all_templates
+
 APP_DIR = os.path.dirname(os.path.abspath(__file__))
 ICON_PATH = os.path.join(APP_DIR, "ielts_icon.png")
 
-# Get user data directory based on platform
-def get_user_data_dir() -> Path:
-    """Get platform-specific user data directory for storing application data.
-    
-    Linux: ~/.local/share/ielts-form/
-    Windows: %APPDATA%/IELTSForm/
-    macOS: ~/Library/Application Support/IELTSForm/
-    """
-    if sys.platform == "win32":
-        # Windows: Use APPDATA (roaming) or LOCALAPPDATA (local)
-        appdata = os.getenv("APPDATA")
-        if appdata:
-            return Path(appdata) / "IELTSForm"
-        # Fallback to user home
-        return Path.home() / "AppData" / "Roaming" / "IELTSForm"
-    elif sys.platform == "darwin":
-        # macOS: Use Application Support
-        return Path.home() / "Library" / "Application Support" / "IELTSForm"
-    else:
-        # Linux and other Unix-like: Use XDG Base Directory Specification
-        # Prefer XDG_DATA_HOME, fallback to ~/.local/share
-        xdg_data_home = os.getenv("XDG_DATA_HOME")
-        if xdg_data_home:
-            return Path(xdg_data_home) / "ielts-form"
-        return Path.home() / ".local" / "share" / "ielts-form"
-
-# Set up data directory and database file
-USER_DATA_DIR = get_user_data_dir()
+# Set up data directory (database paths live in ielts_store)
 USER_DATA_DIR.mkdir(parents=True, exist_ok=True)
-FORMS_DB_FILE = USER_DATA_DIR / "forms.json"
-
-GroupSpec = Tuple[str, int]
 
-LISTENING_BAND_TABLE: List[Tuple[int, float]] = [
-    (39, 9.0),
-    (37, 8.5),
-    (35, 8.0),
-    (32, 7.5),
-    (30, 7.0),
-    (26, 6.5),
-    (23, 6.0),
-    (18, 5.5),
-    (16, 5.0),
-    (13, 4.5),
-    (11, 4.0),
-    (8, 3.5),
-    (6, 3.0),
-    (4, 2.5),
-    (0, 2.0),
-]
-
-READING_BAND_TABLE: List[Tuple[int, float]] = [
-    (39, 9.0),
-    (37, 8.5),
-    (35, 8.0),
-    (33, 7.5),
-    (30, 7.0),
-    (27, 6.5),
-    (23, 6.0),
-    (19, 5.5),
-    (15, 5.0),
-    (13, 4.5),
-    (10, 4.0),
-    (8, 3.5),
-    (6, 3.0),
-    (4, 2.5),
-    (0, 2.0),
-]
-
-
-def normalize_answer(answer: str) -> str:
-    """Normalize answers for comparison (case/spacing insensitive)."""
-    cleaned = re.sub(r"[\s\-]+", "", answer.strip().lower())
-    return cleaned
-
-
-def is_answer_correct(user_answer: str, key_answer: str) -> bool:
-    """Check if user answer matches the key answer.
-    
-    The key answer may contain multiple options separated by "/" (e.g., "gardens / gardening").
-    If the user provides any of these options, it's considered correct.
-    """
-    user_normalized = normalize_answer(user_answer)
-    
-    # Split key answer by "/" to get multiple acceptable options
-    key_options = [opt.strip() for opt in key_answer.split("/")]
-    
-    # Check if user's normalized answer matches any of the key options
-    for key_option in key_options:
-        if user_normalized == normalize_answer(key_option):
-            return True
-    
-    return False
+EDIT_DEBOUNCE_MS = 500  # Quiet period before typed edits are journaled
+JOURNAL_COMPACT_MS = 60 * 1000  # How often the journal is folded into the database
+DATABASE_POLL_MS = 15  # How often startup checks whether the background load has finished
+WRITER_CHECK_MS = 2000  # How often the UI checks whether background saves are failing
+WRITER_CLOSE_TIMEOUT = 5.0  # Seconds to wait for the background writer on exit before saving directly
+FORM_WINDOW_POOL_SIZE = 2  # Closed form windows kept hidden per section for reuse
+TIMER_TICK_SLACK_MS = 5  # Wake just after a second boundary, not just before it
 
+GroupSpec = Tuple[str, int]
 
-def lookup_band(section_name: str, correct: int) -> float:
-    table = LISTENING_BAND_TABLE if section_name.lower() == "listening" else READING_BAND_TABLE
-    for threshold, band in table:
-        if correct >= threshold:
-            return band
-    return 0.0
+# (background, active background) of the big landing-page buttons, in template order
+FEATURED_BUTTON_COLORS = [("#27ae60", "#229954"), ("#e74c3c", "#c0392b"), ("#2980b9", "#2471a3")]
 
+# Form list text colour by status (not-started forms use the list's default colour)
+FORM_STATUS_COLORS = {STATUS_COMPLETED: "#27ae60", STATUS_IN_PROGRESS: "#d98200"}
+FORM_LIST_WHEEL_ROWS = 3  # Form list rows scrolled per mouse wheel step
 
-QUESTION_LINE_RE = re.compile(r"^(\d+(?:&\d+)*)(?:[.)-])?\s+(.*)$")
+HIDDEN_PLACEHOLDER = "HIDDEN"  # Shown in key entries while answers are hidden
 
+class SectionFrame(ttk.Frame):
+    """Scrollable list of question entry rows.
 
-def parse_answer_text(text: str) -> Tuple[Dict[int, str], Dict[int, List[int]]]:
-    """Parse pasted answer text into a question->answer mapping.
-    
-    Returns:
-        Tuple of (mapping, shared_groups):
-        - mapping: Dict[int, str] - question number to answer string
-        - shared_groups: Dict[int, List[int]] - question number to list of questions in same group
-    
-    Handles formats like:
-    - "21 B" -> question 21 has answer B
-    - "21&22 B, D" -> questions 21 and 22 share answers B, D (each answer can only be used once)
-    - "23&24&25 A, B, C" -> questions 23, 24, 25 share answers A, B, C
+    The section's data lives in a SectionModel; each question also has a
+    StringVar for its answer and key entries, kept in sync with the model in
+    both directions.
     """
-    mapping: Dict[int, str] = {}
-    shared_groups: Dict[int, List[int]] = {}  # Maps question to list of questions in its group
-    
-    for raw_line in text.splitlines():
-        line = raw_line.strip()
-        if not line:
-            continue
-        if re.match(r"^(part|passage)\b", line, re.IGNORECASE):
-            continue
-        if line.startswith("("):
-            continue
-        match = QUESTION_LINE_RE.match(line)
-        if not match:
-            continue
-        question_tokens = match.group(1).split("&")
-        answer_blob = match.group(2).strip()
-        if not answer_blob:
-            continue
-        
-        # Parse answers - split by comma or semicolon
-        answers = [ans.strip() for ans in re.split(r",|;", answer_blob) if ans.strip()]
-        if not answers:
-            answers = [answer_blob]
-        
-        # Parse question numbers
-        question_numbers = []
-        for token in question_tokens:
-            try:
-                qnum = int(token)
-            except ValueError:
-                continue
-            if qnum < 1 or qnum > NUM_QUESTIONS:
-                continue
-            question_numbers.append(qnum)
-        
-        if not question_numbers:
-            continue
-        
-        # If multiple questions share answers (e.g., "21&22 B, D")
-        # Store them as a shared group - answers must be matched without replacement
-        if len(question_numbers) > 1:
-            # Store shared group info for all questions in the group
-            for qnum in question_numbers:
-                shared_groups[qnum] = question_numbers.copy()
-            # Store the answer options (comma-separated for shared groups)
-            shared_answer = ", ".join(answers)
-            for qnum in question_numbers:
-                mapping[qnum] = shared_answer
-        else:
-            # Single question - join multiple options with " / " if multiple answers
-            qnum = question_numbers[0]
-            if len(answers) > 1:
-                mapping[qnum] = " / ".join(answers)
-            else:
-                mapping[qnum] = answers[0]
-    
-    return mapping, shared_groups
-
-
-class SectionFrame(ttk.Frame):
-    """Scrollable list of question entry rows."""
 
     def __init__(self, parent, section_name: str, groups: Sequence[GroupSpec]):
         super().__init__(parent)
@@ -203,7 +71,7 @@ class SectionFrame(ttk.Frame):
         self.keys_visible = True
 
         # Create scrollable frame
-        canvas = tk.Canvas(self, highlightthickness=0)
+        self.canvas = canvas = tk.Canvas(self, highlightthickness=0)
         scrollbar = ttk.Scrollbar(self, orient="vertical", command=canvas.yview)
         self.scrollable_frame = ttk.Frame(canvas)
 
@@ -213,6 +81,7 @@ class SectionFrame(ttk.Frame):
         self.scrollable_frame.bind("<Configure>", on_frame_configure)
 
         canvas.create_window((0, 0), window=self.scrollable_frame, anchor="nw")
+
         canvas.configure(yscrollcommand=scrollbar.set)
 
         def on_canvas_configure(event):
@@ -224,10 +93,26 @@ class SectionFrame(ttk.Frame):
         canvas.pack(side="left", fill="both", expand=True)
         scrollbar.pack(side="right", fill="y")
 
+        self.model = SectionModel()
+        self.model.listeners.append(self._on_model_changed)
+        self.user_vars: List[tk.StringVar] = []
+        self.key_vars: List[tk.StringVar] = []
+        self._syncing_var = False  # True while a var write is being copied into the model, or vice versa
+        # Model changes are shown in one after_idle pass, so bulk operations cost one redraw
+        self._dirty_vars: Set[Tuple[str, int]] = set()
+        self._dirty_statuses: Set[int] = set()
+        self._key_entries_dirty = False
+        self._sync_id: Optional[str] = None
+        self._hidden_var = tk.StringVar(self, value=HIDDEN_PLACEHOLDER)  # Shown in every key entry while hidden
         self.user_entries: List[ttk.Entry] = []
         self.key_entries: List[ttk.Entry] = []
         self.status_labels: List[ttk.Label] = []
-        self.shared_groups: Dict[int, List[int]] = {}  # Maps question number to list of questions in same group
+        # Called as edit_callback(field, index, value) for typed edits, after EDIT_DEBOUNCE_MS of quiet;
+        # field is "u" for user answers and "k" for answer keys
+        self.edit_callback: Optional[Callable[[str, int, str], None]] = None
+        self._pending_edits: Set[Tuple[str, int]] = set()
+        self._reported_values: Dict[Tuple[str, int], str] = {}
+        self._edit_flush_id: Optional[str] = None
         self._build_groups()
 
     def _build_groups(self) -> None:
@@ -237,13 +122,20 @@ class SectionFrame(ttk.Frame):
         self.user_entries.clear()
         self.key_entries.clear()
         self.status_labels.clear()
+        self._dirty_vars.clear()  # Queued changes refer to the old vars
+        self._dirty_statuses.clear()
+
+        question_number = sum(int(count) for _, count in self.groups)
+        self.model.resize(question_number)
+        self.user_vars = [self._make_var(FIELD_ANSWER, idx) for idx in range(question_number)]
+        self.key_vars = [self._make_var(FIELD_KEY, idx) for idx in range(question_number)]
 
         # Create main container with columns
-        main_container = ttk.Frame(self.scrollable_frame)
-        main_container.pack(fill="both", expand=True, padx=10, pady=5)
+        self.main_container = ttk.Frame(self.scrollable_frame)
+        self.main_container.pack(fill="both", expand=True, padx=10, pady=5)
 
         # Create header row
-        header_frame = ttk.Frame(main_container)
+        header_frame = ttk.Frame(self.main_container)
         header_frame.pack(fill="x", pady=(0, 10))
         for col_index, (title, _) in enumerate(self.groups):
             # Create a frame for each header to center the text
@@ -255,12 +147,8 @@ class SectionFrame(ttk.Frame):
         for col_index in range(len(self.groups)):
             header_frame.columnconfigure(col_index, weight=1)
 
-        # Create columns for each group
-        question_number = 1
-        max_rows = max(int(count) for _, count in self.groups)
-        
         # Create a grid for all questions
-        questions_frame = ttk.Frame(main_container)
+        questions_frame = ttk.Frame(self.main_container)
         questions_frame.pack(fill="both", expand=True)
 
         # Configure columns for equal width per group
@@ -272,263 +160,248 @@ class SectionFrame(ttk.Frame):
             questions_frame.columnconfigure(base_col + 2, weight=1, minsize=80)  # Key entry
             questions_frame.columnconfigure(base_col + 3, weight=0, minsize=30)  # Status
 
+        # Widgets are created group by group, so Tab moves through questions in order
+        idx = 0
         for col_index, (_, count) in enumerate(self.groups):
-            start_number = question_number
             for row in range(int(count)):
-                q_num = start_number + row
-                
                 # Question number
-                num_label = ttk.Label(questions_frame, text=f"{q_num}.", width=4, anchor="e")
+                num_label = ttk.Label(questions_frame, text=f"{idx + 1}.", width=4, anchor="e")
                 num_label.grid(row=row, column=col_index * 4, padx=2, pady=1, sticky="e")
 
                 # User answer entry
-                user_entry = ttk.Entry(questions_frame, width=10)
+                user_entry = ttk.Entry(questions_frame, width=10, textvariable=self.user_vars[idx])
                 user_entry.grid(row=row, column=col_index * 4 + 1, padx=2, pady=1, sticky="ew")
 
                 # Key answer entry
                 key_entry = ttk.Entry(questions_frame, width=10)
                 key_entry.grid(row=row, column=col_index * 4 + 2, padx=2, pady=1, sticky="ew")
+                self._configure_key_entry(key_entry, idx)
 
                 # Status label
-                status_label = ttk.Label(questions_frame, text="", width=3)
+                symbol, color = self._status_of(idx)
+                status_label = ttk.Label(questions_frame, text=symbol, foreground=color, width=3)
                 status_label.grid(row=row, column=col_index * 4 + 3, padx=2, pady=1)
 
+                for widget, field in ((user_entry, FIELD_ANSWER), (key_entry, FIELD_KEY)):
+                    # Journal typed edits (FocusOut catches mouse paste/cut)
+                    widget.bind("<KeyRelease>", lambda e, f=field, i=idx: self._on_entry_edited(f, i))
+                    widget.bind("<FocusOut>", lambda e, f=field, i=idx: self._on_entry_edited(f, i), add="+")
+
                 self.user_entries.append(user_entry)
                 self.key_entries.append(key_entry)
                 self.status_labels.append(status_label)
-            question_number += int(count)
+                idx += 1
+
+    def _make_var(self, field: str, idx: int) -> tk.StringVar:
+        var = tk.StringVar(self)
+        var.trace_add("write", lambda *_: self._on_var_written(field, idx))
+        return var
+
+    def _on_var_written(self, field: str, idx: int) -> None:
+        """Copy a typed value from an entry's StringVar into the model."""
+        if self._syncing_var:
+            return
+        var = (self.key_vars if field == FIELD_KEY else self.user_vars)[idx]
+        self._syncing_var = True
+        try:
+            if field == FIELD_KEY:
+                self.model.set_key(idx, var.get())
+            else:
+                self.model.set_answer(idx, var.get())
+        finally:
+            self._syncing_var = False
+
+    def _on_model_changed(self, field: str, idx: int) -> None:
+        """Queue a model change for the widgets (vars for values, labels for verdicts)."""
+        if field == FIELD_VERDICT:
+            self._dirty_statuses.add(idx)
+        elif self._syncing_var:
+            return  # The change came from this var
+        else:
+            self._dirty_vars.add((field, idx))
+        self._schedule_widget_sync()
+
+    def _schedule_widget_sync(self) -> None:
+        if self._sync_id is None:
+            self._sync_id = self.after_idle(self.sync_widgets)
+
+    def sync_widgets(self) -> None:
+        """Push queued model changes into the vars, status labels and key entries now."""
+        if self._sync_id is not None:
+            self.after_cancel(self._sync_id)
+            self._sync_id = None
+        dirty_vars, self._dirty_vars = self._dirty_vars, set()
+        dirty_statuses, self._dirty_statuses = self._dirty_statuses, set()
+        self._syncing_var = True
+        try:
+            # Values are read at flush time, so several changes to one question write once
+            for field, idx in dirty_vars:
+                if field == FIELD_KEY:
+                    self.key_vars[idx].set(self.model.key(idx))
+                else:
+                    self.user_vars[idx].set(self.model.answer(idx))
+        finally:
+            self._syncing_var = False
+        for idx in dirty_statuses:
+            self._show_status(idx)
+        if self._key_entries_dirty:
+            self._key_entries_dirty = False
+            for idx, entry in enumerate(self.key_entries):
+                self._configure_key_entry(entry, idx)
+
+    def _status_of(self, idx: int) -> Tuple[str, str]:
+        """(symbol, color) for question idx's verdict; "≈" marks a wrong but near-miss spelling."""
+        verdict = self.model.verdicts[idx]
+        if verdict is None:
+            return "", "black"
+        if verdict:
+            return "✓", "green"
+        return ("≈", "#d98200") if self.model.near_misses[idx] else ("✗", "red")
+
+    def _configure_key_entry(self, entry: ttk.Entry, idx: int) -> None:
+        if self.keys_visible:
+            entry.config(textvariable=self.key_vars[idx], state="normal", foreground="black")
+        else:
+            entry.config(textvariable=self._hidden_var, state="readonly", foreground="#cccccc")
+
+    def _show_status(self, idx: int) -> None:
+        symbol, color = self._status_of(idx)
+        self.status_labels[idx].config(text=symbol, foreground=color)
+
+    def _on_entry_edited(self, field: str, index: int) -> None:
+        """Queue an entry for edit_callback; restarts the debounce window on every keystroke."""
+        if self.edit_callback is None:
+            return
+        self._pending_edits.add((field, index))
+        if self._edit_flush_id is not None:
+            self.after_cancel(self._edit_flush_id)
+        self._edit_flush_id = self.after(EDIT_DEBOUNCE_MS, self.flush_edits)
+
+    def flush_edits(self) -> None:
+        """Report queued entry edits whose value actually changed."""
+        if self._edit_flush_id is not None:
+            self.after_cancel(self._edit_flush_id)
+            self._edit_flush_id = None
+        pending, self._pending_edits = self._pending_edits, set()
+        if self.edit_callback is None:
+            return
+        for field, index in sorted(pending):
+            value = (self.model.key(index) if field == FIELD_KEY else self.model.answer(index)).strip()
+            if self._reported_values.get((field, index)) == value:
+                continue
+            self._reported_values[(field, index)] = value
+            self.edit_callback(field, index, value)
+
+    def destroy(self) -> None:
+        # Don't leave debounce or sync callbacks pointing at destroyed widgets
+        if self._edit_flush_id is not None:
+            self.after_cancel(self._edit_flush_id)
+            self._edit_flush_id = None
+        if self._sync_id is not None:
+            self.after_cancel(self._sync_id)
+            self._sync_id = None
+        super().destroy()
 
     def set_groups(self, groups: Sequence[GroupSpec]) -> None:
         self.groups = list(groups)
         self._build_groups()
 
+    @property
+    def shared_groups(self) -> Dict[int, List[int]]:
+        """Maps question number to list of questions in same group."""
+        return self.model.shared_groups
+
     def get_answers(self) -> List[str]:
-        return [entry.get().strip() for entry in self.user_entries]
+        return self.model.answers()
 
     def get_answer_keys(self) -> List[str]:
-        """Get answer keys, returning stored text if hidden."""
-        result = []
-        for entry in self.key_entries:
-            text = entry.get().strip()
-            # If showing placeholder, get stored text instead
-            if text == "HIDDEN" and hasattr(entry, '_stored_text'):
-                text = entry._stored_text
-            result.append(text)
-        return result
+        """Get answer keys (the real keys, also while they are hidden)."""
+        return self.model.keys()
 
     def clear(self) -> None:
         """Clear user answers and status labels."""
-        for entry in self.user_entries:
-            entry.delete(0, tk.END)
-        for label in self.status_labels:
-            label.config(text="")
+        self.clear_user_answers()
+        self.reset_feedback()
 
     def clear_user_answers(self) -> None:
         """Clear only user answers (keep keys and status)."""
-        for entry in self.user_entries:
-            entry.delete(0, tk.END)
+        self.model.clear_answers()
 
     def clear_keys(self) -> None:
         """Clear only answer keys."""
-        for entry in self.key_entries:
-            entry.config(state="normal")
-            entry.delete(0, tk.END)
-            # Clear stored text if exists
-            if hasattr(entry, '_stored_text'):
-                delattr(entry, '_stored_text')
-            # If hidden, show placeholder
-            if not self.keys_visible:
-                entry.insert(0, "HIDDEN")
-                entry.config(state="readonly", foreground="#cccccc")
+        self.model.clear_keys()
 
     def clear_all(self) -> None:
         """Clear both user answers and keys, plus status labels."""
-        for entry in self.user_entries:
-            entry.delete(0, tk.END)
-        for entry in self.key_entries:
-            entry.config(state="normal")
-            entry.delete(0, tk.END)
-            # Clear stored text if exists
-            if hasattr(entry, '_stored_text'):
-                delattr(entry, '_stored_text')
-            # If hidden, show placeholder
-            if not self.keys_visible:
-                entry.insert(0, "HIDDEN")
-                entry.config(state="readonly", foreground="#cccccc")
-        for label in self.status_labels:
-            label.config(text="")
+        self.clear_user_answers()
+        self.clear_keys()
+        self.reset_feedback()
+
+    def reset(self) -> None:
+        """Blank the section (answers, keys, groups, feedback) so the frame can show another form."""
+        self.flush_edits()
+        self._pending_edits.clear()
+        self._reported_values.clear()
+        self.model.reset()
+        self.canvas.yview_moveto(0)
+
+    def compiled_answer_key(self) -> CompiledKey:
+        """Return the compiled key for the current keys, recompiling only if they changed."""
+        return self.model.compiled_answer_key()
 
     def evaluate(self) -> Tuple[int, int]:
         """Evaluate answers, handling shared answer groups correctly."""
-        correct = 0
-        evaluated = 0
-        processed_groups = set()  # Track which groups we've already processed
-        
-        # First, evaluate questions that are NOT in shared groups
-        for idx, (user_entry, key_entry, status_label) in enumerate(
-            zip(self.user_entries, self.key_entries, self.status_labels), start=1
-        ):
-            # Skip if this question is part of a shared group (will process groups separately)
-            if idx in self.shared_groups:
-                continue
-            
-            key_raw = key_entry.get().strip()
-            if not key_raw:
-                status_label.config(text="")
-                continue
-            evaluated += 1
-            user_raw = user_entry.get().strip()
-            is_correct = is_answer_correct(user_raw, key_raw)
-            symbol = "✓" if is_correct else "✗"
-            color = "green" if is_correct else "red"
-            status_label.config(text=symbol, foreground=color)
-            if is_correct:
-                correct += 1
-        
-        # Now evaluate shared groups (e.g., "21&22 B, D")
-        for qnum, group_questions in self.shared_groups.items():
-            # Skip if we've already processed this group
-            group_tuple = tuple(sorted(group_questions))
-            if group_tuple in processed_groups:
-                continue
-            processed_groups.add(group_tuple)
-            
-            # Get all entries for this group
-            group_user_answers = []
-            group_key_answers = []
-            group_labels = []
-            group_indices = []
-            
-            for q in group_questions:
-                if q < 1 or q > len(self.user_entries):
-                    continue
-                idx = q - 1  # Convert to 0-based index
-                group_user_answers.append(self.user_entries[idx].get().strip())
-                key_raw = self.key_entries[idx].get().strip()
-                group_key_answers.append(key_raw)
-                group_labels.append(self.status_labels[idx])
-                group_indices.append(q)
-            
-            # Check if any key is empty - skip group if all keys empty
-            if not any(group_key_answers):
-                for label in group_labels:
-                    label.config(text="")
-                continue
-            
-            evaluated += len(group_questions)
-            
-            # Parse key answers - they should be comma-separated (e.g., "B, D")
-            # Get the first non-empty key answer
-            key_answer_str = next((k for k in group_key_answers if k), "")
-            if not key_answer_str:
-                for label in group_labels:
-                    label.config(text="")
-                continue
-            
-            # Parse available answer options (split by comma)
-            available_options = [opt.strip() for opt in key_answer_str.split(",") if opt.strip()]
-            
-            # Match user answers to available options without replacement
-            # This ensures each option can only be used once
-            used_options = set()
-            group_correct = 0
-            
-            for user_answer, label in zip(group_user_answers, group_labels):
-                user_normalized = normalize_answer(user_answer)
-                matched = False
-                
-                # Try to match user answer to an unused option
-                for option in available_options:
-                    option_normalized = normalize_answer(option)
-                    if user_normalized == option_normalized and option not in used_options:
-                        matched = True
-                        used_options.add(option)
-                        group_correct += 1
-                        break
-                
-                # Update label
-                symbol = "✓" if matched else "✗"
-                color = "green" if matched else "red"
-                label.config(text=symbol, foreground=color)
-            
-            correct += group_correct
-        
-        return correct, evaluated
+        return self.model.evaluate()
 
     def reset_feedback(self) -> None:
-        for label in self.status_labels:
-            label.config(text="")
+        self.model.clear_verdicts()
 
     def question_count(self) -> int:
-        return len(self.user_entries)
+        return self.model.question_count()
 
     def set_keys_visible(self, visible: bool) -> None:
+        """Show the keys, or show HIDDEN in every key entry (the keys themselves are kept)."""
+        if visible == self.keys_visible:
+            return
         self.keys_visible = visible
-        HIDDEN_PLACEHOLDER = "HIDDEN"
-        
-        for entry in self.key_entries:
-            current_text = entry.get()
-            if not visible:
-                # Store actual text (only if not already the placeholder)
-                if current_text != HIDDEN_PLACEHOLDER:
-                    entry._stored_text = current_text
-                # Replace with fixed placeholder
-                entry.config(state="normal")
-                entry.delete(0, tk.END)
-                entry.insert(0, HIDDEN_PLACEHOLDER)
-                entry.config(state="readonly", foreground="#cccccc")
-            else:
-                # Restore actual text
-                stored_text = getattr(entry, '_stored_text', "")
-                entry.config(state="normal", foreground="black")
-                entry.delete(0, tk.END)
-                entry.insert(0, stored_text)
-                # Clean up stored text
-                if hasattr(entry, '_stored_text'):
-                    delattr(entry, '_stored_text')
-
-    def apply_answer_keys(self, mapping: Dict[int, str], shared_groups: Optional[Dict[int, List[int]]] = None) -> None:
+        self._key_entries_dirty = True
+        self._schedule_widget_sync()
+
+    def apply_answer_keys(self, mapping: Dict[int, str], shared_groups: Optional[Dict[int, List[int]]] = None,
+                          word_limits: Optional[Dict[int, WordLimit]] = None) -> None:
         """Apply answer keys to entries.
         
         Args:
             mapping: Question number to answer string
             shared_groups: Question number to list of questions in same group (for shared answers)
+            word_limits: Question number to the word limit set by the key's instructions
         """
-        if shared_groups:
-            self.shared_groups = shared_groups
-        else:
-            self.shared_groups = {}
-        
-        for idx, entry in enumerate(self.key_entries, start=1):
-            value = mapping.get(idx)
-            if value:
-                # Make sure entry is editable
-                entry.config(state="normal")
-                entry.delete(0, tk.END)
-                entry.insert(0, value)
-                # Update stored text if hidden
-                if not self.keys_visible:
-                    entry._stored_text = value
-                    entry.delete(0, tk.END)
-                    entry.insert(0, "HIDDEN")
-                    entry.config(state="readonly", foreground="#cccccc")
+        self.model.apply_answer_keys(mapping, shared_groups, word_limits)
+        self.model.compiled_answer_key()
 
 
 class FormWindow:
     """Popup window for a single IELTS form."""
     
-    def __init__(self, parent: tk.Tk, form_name: str, section_name: str, groups: Sequence[GroupSpec], 
-                 default_width: int = 1000, default_height: int = 700, min_width: int = 1000, min_height: int = 700):
+    def __init__(self, parent: tk.Tk, form_name: str, template: TestTemplate, start_hidden: bool = False):
+        section_name = template.title
         self.window = tk.Toplevel(parent)
+        if start_hidden:
+            self.window.withdraw()  # Pre-built for the window pool; shown by IELTSApp.acquire_form_window
         self.window.title(f"{form_name} - {section_name}")
         self.window.configure(bg="#f5f5f5")
         self.form_name = form_name
+        self.template = template
         self.section_name = section_name
         self.answers_hidden = False
-        self.default_width = default_width
-        self.default_height = default_height
-        self.min_width = min_width
-        self.min_height = min_height
+        self.default_width = template.window_sizes["default_width"]
+        self.default_height = template.window_sizes["default_height"]
+        self.min_width = template.window_sizes["min_width"]
+        self.min_height = template.window_sizes["min_height"]
+        # Called after bulk changes (paste, clear, submit, hide) that typed-edit journaling misses
+        self.state_changed_callback: Optional[Callable[[], None]] = None
+        # Called as attempt_callback(correct, evaluated) after each scored submit, before state_changed_callback
+        self.attempt_callback: Optional[Callable[[int, int], None]] = None
         
         # Main container
         main_frame = ttk.Frame(self.window, padding="15")
@@ -537,18 +410,20 @@ class FormWindow:
         # Header with form name and timer
         header_frame = ttk.Frame(main_frame)
         header_frame.pack(fill="x", pady=(0, 15))
-        title_label = ttk.Label(header_frame, text=form_name, style="Heading.TLabel")
-        title_label.pack(side="left")
+        self.title_label = ttk.Label(header_frame, text=form_name, style="Heading.TLabel")
+        self.title_label.pack(side="left")
         
         # Timer section
         timer_frame = ttk.Frame(header_frame)
         timer_frame.pack(side="right")
         
-        # Set timer duration based on section
-        timer_minutes = 30 if section_name == "Listening" else 60
-        self.timer_seconds = timer_minutes * 60
+        self.timer_duration = template.timer_minutes * 60
+        self.timer_seconds = self.timer_duration  # Remaining seconds while stopped or paused
         self.timer_running = False
         self.timer_end_time = None
+        self._shown_seconds: Optional[int] = None  # Last value drawn on the timer label
+        # Told when the timer starts or stops so IELTSApp only ticks running timers
+        self.timer_state_callback: Optional[Callable[["FormWindow"], None]] = None
         
         self.timer_label = ttk.Label(timer_frame, text=f"⏱️ {self.format_time(self.timer_seconds)}", 
                                      font=("Segoe UI", 12, "bold"), foreground="#2c3e50")
@@ -562,16 +437,16 @@ class FormWindow:
                                  command=self.reset_timer, width=8)
         reset_button.pack(side="left", padx=2)
         
-        # Start timer update after window is fully initialized
-        self.window.after(100, self.update_timer)
-        
         # Section frame
-        self.section_box = SectionFrame(main_frame, section_name, groups)
+        self.section_box = SectionFrame(main_frame, section_name, template.groups)
         self.section_box.pack(fill="both", expand=True)
+        self.section_box.model.listeners.append(self._on_model_changed)
         
-        # Score label
+        # Score label; live grading shows a running score here too, but only a submitted one is saved
         self.score_label = ttk.Label(main_frame, text="", style="Heading.TLabel")
         self.score_label.pack(pady=8)
+        self.submitted_score_text = ""
+        self.submitted_score: Optional[Tuple[int, int]] = None  # (correct, evaluated) at the last Submit
         
         # Buttons with icons
         button_frame = ttk.Frame(main_frame)
@@ -581,19 +456,46 @@ class FormWindow:
         ttk.Button(button_frame, text="📋 Paste Right Answer", style="TButton", command=self.on_paste_answers_clicked).pack(side="left", padx=3)
         self.hide_button = ttk.Button(button_frame, text="👁️ Hide Answers", style="TButton", command=self.on_toggle_hide_answers)
         self.hide_button.pack(side="left", padx=3)
+        self.live_var = tk.BooleanVar(self.window, value=False)
+        ttk.Checkbutton(button_frame, text="⚡ Live Grading", variable=self.live_var,
+                        command=self.on_toggle_live_grading).pack(side="left", padx=3)
+        # General Training mocks convert Reading scores with their own band table
+        self.general_training_var = tk.BooleanVar(self.window, value=template.band_scheme == "general")
+        if template.band_section and template.band_section.lower() != "listening":
+            ttk.Checkbutton(button_frame, text="General Training", variable=self.general_training_var,
+                            command=self.on_toggle_band_scheme).pack(side="left", padx=3)
         ttk.Button(button_frame, text="👀 Preview", style="TButton", command=self.on_preview_clicked).pack(side="left", padx=3)
         ttk.Button(button_frame, text="🗑️ Clear All", style="TButton", command=self.on_clear_clicked).pack(side="left", padx=3)
         ttk.Button(button_frame, text="💾 Save Answers", style="TButton", command=self.on_save_clicked).pack(side="left", padx=3)
         
         # Auto-size window to fit content
-        # NOTE: To manually adjust popup window size, modify the default_width/default_height
-        # parameters when creating FormWindow (in on_form_clicked method)
+        # NOTE: To manually adjust popup window size, modify the "window" sizes in the
+        # section's template file (templates/<section>.json)
         self.window.update_idletasks()
         width = max(self.window.winfo_reqwidth() + 40, self.default_width)
         height = max(self.window.winfo_reqheight() + 40, self.default_height)
         self.window.geometry(f"{width}x{height}")
         self.window.minsize(self.min_width, self.min_height)
     
+    def bind_form(self, form_name: str) -> None:
+        """Point a (reset) window at another form of the same section."""
+        self.form_name = form_name
+        self.window.title(f"{form_name} - {self.section_name}")
+        self.title_label.config(text=form_name)
+    
+    def reset(self) -> None:
+        """Return the window to a blank, unsubmitted form with a stopped timer."""
+        self.state_changed_callback = None
+        self.attempt_callback = None
+        self.section_box.edit_callback = None
+        self.section_box.reset()
+        self.live_var.set(False)
+        self.general_training_var.set(self.template.band_scheme == "general")
+        if self.answers_hidden:
+            self.on_toggle_hide_answers()
+        self._clear_score()
+        self.reset_timer()
+    
     def format_time(self, seconds: int) -> str:
         """Format seconds as MM:SS."""
         mins = seconds // 60
@@ -603,89 +505,123 @@ class FormWindow:
     def toggle_timer(self) -> None:
         """Start or pause the timer."""
         if not self.timer_running:
-            # Start timer
-            if self.timer_end_time is None:
-                self.timer_end_time = datetime.now() + timedelta(seconds=self.timer_seconds)
-            else:
-                # Resume from where we left off
-                remaining = (self.timer_end_time - datetime.now()).total_seconds()
-                if remaining <= 0:
-                    self.timer_end_time = datetime.now() + timedelta(seconds=self.timer_seconds)
-                else:
-                    self.timer_end_time = datetime.now() + timedelta(seconds=remaining)
+            # Start, or resume from the remaining time saved on pause
+            self.timer_end_time = datetime.now() + timedelta(seconds=self.timer_seconds)
             self.timer_running = True
             self.timer_button.config(text="⏸ Pause")
         else:
-            # Pause timer
+            # Pause timer, keeping the remaining time
+            remaining = (self.timer_end_time - datetime.now()).total_seconds()
+            self.timer_seconds = max(int(remaining), 0)
+            self.timer_end_time = None
             self.timer_running = False
             self.timer_button.config(text="▶ Start")
+        self._timer_state_changed()
     
     def reset_timer(self) -> None:
         """Reset timer to initial value."""
-        timer_minutes = 30 if self.section_name == "Listening" else 60
-        self.timer_seconds = timer_minutes * 60
+        self.timer_seconds = self.timer_duration
         self.timer_running = False
         self.timer_end_time = None
+        self._shown_seconds = self.timer_seconds
         self.timer_label.config(text=f"⏱️ {self.format_time(self.timer_seconds)}", foreground="#2c3e50")
         self.timer_button.config(text="▶ Start")
+        self._timer_state_changed()
     
-    def update_timer(self) -> None:
-        """Update timer display every second."""
-        # Check if window still exists by trying to access a widget property
-        try:
-            # Try to access window title - if window is destroyed, this will raise TclError
-            _ = self.window.title()
-        except (tk.TclError, AttributeError, RuntimeError):
-            # Window was destroyed
-            return
+    def _timer_state_changed(self) -> None:
+        if self.timer_state_callback is not None:
+            self.timer_state_callback(self)
+    
+    def tick_timer(self, now: datetime) -> Optional[float]:
+        """Redraw the timer if its displayed second changed.
         
-        if self.timer_running and self.timer_end_time:
-            remaining = int((self.timer_end_time - datetime.now()).total_seconds())
-            if remaining <= 0:
-                # Time's up!
-                self.timer_running = False
-                try:
-                    self.timer_label.config(text="⏱️ 00:00", foreground="#e74c3c")
-                    self.timer_button.config(text="▶ Start")
-                    # Show alarm
-                    self.window.bell()  # System beep
-                    messagebox.showwarning("Time's Up!", f"Your {self.section_name} test time has ended!")
-                except tk.TclError:
-                    return  # Window was destroyed
-            else:
-                self.timer_seconds = remaining
-                # Change color when less than 5 minutes remaining
-                color = "#e74c3c" if remaining < 300 else "#2c3e50"
-                try:
-                    self.timer_label.config(text=f"⏱️ {self.format_time(remaining)}", foreground=color)
-                except tk.TclError:
-                    return  # Window was destroyed
-        else:
-            # Show current time if paused
-            if self.timer_end_time:
-                remaining = int((self.timer_end_time - datetime.now()).total_seconds())
-                if remaining > 0:
-                    self.timer_seconds = remaining
-                    try:
-                        self.timer_label.config(text=f"⏱️ {self.format_time(remaining)}", foreground="#2c3e50")
-                    except tk.TclError:
-                        return  # Window was destroyed
-        
-        # Schedule next update only if window still exists
-        try:
-            self.window.after(1000, self.update_timer)
-        except tk.TclError:
-            pass  # Window was destroyed
+        Returns seconds until the display next changes, or None once the timer
+        is no longer running. Called by IELTSApp's shared timer scheduler.
+        """
+        if not self.timer_running or self.timer_end_time is None:
+            return None
+        remaining_exact = (self.timer_end_time - now).total_seconds()
+        remaining = int(remaining_exact)
+        if remaining <= 0:
+            # Time's up!
+            self.timer_running = False
+            self.timer_end_time = None
+            self.timer_seconds = self.timer_duration  # Start runs a fresh timer
+            self._shown_seconds = 0
+            self.timer_label.config(text="⏱️ 00:00", foreground="#e74c3c")
+            self.timer_button.config(text="▶ Start")
+            self._timer_state_changed()
+            # Show alarm
+            self.window.bell()  # System beep
+            messagebox.showwarning("Time's Up!", f"Your {self.section_name} test time has ended!")
+            return None
+        if remaining != self._shown_seconds:
+            self._shown_seconds = remaining
+            # Change color when less than 5 minutes remaining
+            color = "#e74c3c" if remaining < 300 else "#2c3e50"
+            self.timer_label.config(text=f"⏱️ {self.format_time(remaining)}", foreground=color)
+        # The display changes when remaining_exact drops below the shown whole second
+        return remaining_exact - remaining
+    
+    def _state_changed(self) -> None:
+        if self.state_changed_callback is not None:
+            self.state_changed_callback()
     
     def on_submit_clicked(self) -> None:
         # Evaluate only questions that have answer keys (optional)
         correct, evaluated = self.section_box.evaluate()
-        total = self.section_box.question_count()
+        self.submitted_score_text = self._show_score(correct, evaluated)
+        if not self.submitted_score_text:
+            self.submitted_score = None
+            return
+        self.submitted_score = (correct, evaluated)
+        if self.attempt_callback is not None:
+            self.attempt_callback(correct, evaluated)
+        self._state_changed()
+    
+    def _show_score(self, correct: int, evaluated: int) -> str:
+        """Show the score and band. Returns the text shown, or "" if no question has a key."""
         if evaluated == 0:
             self.score_label.config(text="No answer keys provided. Fill in answer keys to get a score.")
-            return
-        band = lookup_band(self.section_name, correct)
-        self.score_label.config(text=f"{self.section_name}: {correct}/{evaluated} correct (out of {evaluated} with keys) · Band {band:.1f}")
+            return ""
+        score_text = f"{correct}/{evaluated} correct (out of {evaluated} with keys)"
+        if not self.template.band_section:
+            text = f"{self.section_name}: {score_text}"  # No band for drills and quizzes
+        else:
+            band = lookup_band(self.template.band_section, correct, self.band_scheme())
+            title = f"{self.section_name} (General Training)" if self.band_scheme() == "general" else self.section_name
+            text = f"{title}: {score_text} · Band {band:.1f}"
+        self.score_label.config(text=text)
+        return text
+
+    def _clear_score(self) -> None:
+        self.score_label.config(text="")
+        self.submitted_score_text = ""
+        self.submitted_score = None
+    
+    def _on_model_changed(self, field: str, index: int) -> None:
+        # Live grading re-grades as the user types; keep the running score in step
+        if field == FIELD_SCORE and self.section_box.model.score is not None:
+            self._show_score(*self.section_box.model.score)
+    
+    def band_scheme(self) -> str:
+        return "general" if self.general_training_var.get() else "academic"
+    
+    def on_toggle_band_scheme(self) -> None:
+        """Switch between the Academic and General Training band tables."""
+        if self.submitted_score is not None:
+            # Re-band the submitted counts; edits made since Submit don't change them
+            self.submitted_score_text = self._show_score(*self.submitted_score)
+        elif self.submitted_score_text:
+            pass  # Saved before counts were kept; its band can't be recomputed
+        elif self.section_box.model.score is not None:
+            self._show_score(*self.section_box.model.score)
+        self._state_changed()
+    
+    def on_toggle_live_grading(self) -> None:
+        """Grade each edit as it is typed (only the edited question or its shared group)."""
+        self.section_box.model.set_live_grading(self.live_var.get())
+        self._state_changed()
     
     def on_paste_answers_clicked(self) -> None:
         dialog = tk.Toplevel(self.window)
@@ -721,19 +657,21 @@ class FormWindow:
         if not text.strip():
             return
         
-        mapping, shared_groups = parse_answer_text(text)
+        mapping, shared_groups, word_limits = parse_answer_text(text, self.section_box.question_count())
         if not mapping:
             messagebox.showinfo("No answers detected", "Make sure the text includes numbered lines.")
             return
         
-        self.section_box.apply_answer_keys(mapping, shared_groups)
+        self.section_box.apply_answer_keys(mapping, shared_groups, word_limits)
         self.section_box.reset_feedback()
-        self.score_label.config(text="")
+        self._clear_score()
+        self._state_changed()
     
     def on_toggle_hide_answers(self) -> None:
         self.answers_hidden = not self.answers_hidden
         self.hide_button.config(text="👁️ Show Answers" if not self.answers_hidden else "👁️ Hide Answers")
         self.section_box.set_keys_visible(not self.answers_hidden)
+        self._state_changed()
     
     def on_preview_clicked(self) -> None:
         answers = self.section_box.get_answers()
@@ -793,23 +731,27 @@ class FormWindow:
         action = result["action"]
         if action == "user":
             self.section_box.clear_user_answers()
-            self.score_label.config(text="")
+            self._clear_score()
         elif action == "keys":
             self.section_box.clear_keys()
             self.section_box.reset_feedback()
-            self.score_label.config(text="")
+            self._clear_score()
         elif action == "all":
             self.section_box.clear_all()
-            self.score_label.config(text="")
-        # If cancel, do nothing
+            self._clear_score()
+        else:
+            return  # Cancelled
+        self._state_changed()
     
     def save_state(self) -> Dict:
         """Save current form state (answers, keys, score, etc.)."""
         return {
-            "user_answers": self.section_box.get_answers(),
-            "answer_keys": self.section_box.get_answer_keys(),
-            "score_text": self.score_label.cget("text"),
+            **self.section_box.model.to_state(),
+            "score_text": self.submitted_score_text,
+            "submitted_score": list(self.submitted_score) if self.submitted_score is not None else None,
             "answers_hidden": self.answers_hidden,
+            "live_grading": self.live_var.get(),
+            "band_scheme": self.band_scheme(),
         }
     
     def load_state(self, state: Dict) -> None:
@@ -817,25 +759,24 @@ class FormWindow:
         if not state:
             return
         
-        # Restore user answers
-        user_answers = state.get("user_answers", [])
-        for idx, entry in enumerate(self.section_box.user_entries):
-            if idx < len(user_answers):
-                entry.delete(0, tk.END)
-                entry.insert(0, user_answers[idx])
-        
-        # Restore answer keys
-        answer_keys = state.get("answer_keys", [])
-        for idx, entry in enumerate(self.section_box.key_entries):
-            if idx < len(answer_keys) and answer_keys[idx]:
-                entry.config(state="normal")
-                entry.delete(0, tk.END)
-                entry.insert(0, answer_keys[idx])
-        
-        # Restore score
+        # Restore user answers, answer keys and shared groups
+        self.section_box.model.load_state(state)
+        
+        self.general_training_var.set(state.get("band_scheme", self.template.band_scheme) == "general")
+        
+        # Restore the submitted score
         score_text = state.get("score_text", "")
         if score_text:
             self.score_label.config(text=score_text)
+            self.submitted_score_text = score_text
+        submitted_score = state.get("submitted_score")
+        if score_text and submitted_score:
+            self.submitted_score = (int(submitted_score[0]), int(submitted_score[1]))
+        
+        # Restore live grading (grades the restored answers once)
+        if state.get("live_grading", False):
+            self.live_var.set(True)
+            self.section_box.model.set_live_grading(True)
         
         # Restore hide state (this will handle hiding keys if needed)
         answers_hidden = state.get("answers_hidden", False)
@@ -859,16 +800,29 @@ class FormWindow:
 
 
 class FormListFrame(ttk.Frame):
-    """Frame showing list of forms for a section with simple button-based UI."""
+    """Frame showing list of forms for a section with simple button-based UI.
+
+    The forms live in a FormIndex, which also answers the search box and
+    keeps each form's status. The listbox only ever holds the rows that fit
+    on screen; scrolling, the scrollbar and the arrow keys move a window over
+    the filtered forms and refill those rows.
+    """
     
-    def __init__(self, parent, section_name: str, on_form_clicked, get_form_state=None, save_callback=None, delete_callback=None):
+    def __init__(self, parent, section_name: str, on_form_clicked, get_form_state=None, save_callback=None, delete_callback=None,
+                 import_keys_callback=None, section_id: Optional[str] = None):
         super().__init__(parent)
         self.section_name = section_name
+        self.section_id = section_id or section_name.lower()  # Prefix of this section's form keys
         self.on_form_clicked = on_form_clicked
         self.get_form_state = get_form_state  # Function to get form state for status
         self.save_callback = save_callback  # Function to save database
         self.delete_callback = delete_callback  # Function to delete form state from database
-        self.forms: List[str] = []
+        self.import_keys_callback = import_keys_callback  # Function to import a folder of answer keys
+        self.index = FormIndex()
+        self._shown: List[str] = []  # Forms matching the search, in list order
+        self._top = 0  # Index in _shown of the first listbox row
+        self._rows = 1  # Listbox rows that fit completely
+        self._selected: Optional[str] = None  # Kept while the selected form is scrolled out of the listbox
         self._click_in_progress = False  # Flag to prevent rapid double-clicks
         
         # Header
@@ -888,17 +842,31 @@ class FormListFrame(ttk.Frame):
         add_button = ttk.Button(button_frame, text="➕ New", style="TButton", command=self.on_add_form)
         add_button.pack(side="right")
         
-        # Simple listbox with scrollbar (most stable approach)
+        if import_keys_callback is not None:
+            import_button = ttk.Button(button_frame, text="📚 Import Keys", style="TButton", command=import_keys_callback)
+            import_button.pack(side="right", padx=(0, 5))
+        
+        # Type-ahead search and status totals
+        search_frame = ttk.Frame(self)
+        search_frame.pack(fill="x", padx=15)
+        ttk.Label(search_frame, text="🔍").pack(side="left")
+        self.search_var = tk.StringVar(self)
+        self.search_entry = ttk.Entry(search_frame, textvariable=self.search_var, width=30)
+        self.search_entry.pack(side="left", padx=(5, 0))
+        self.search_var.trace_add("write", lambda *args: self.on_search_changed())
+        self.summary_label = ttk.Label(search_frame, style="Subtitle.TLabel")
+        self.summary_label.pack(side="right")
+        
+        # Listbox with scrollbar; the scrollbar spans all filtered forms, not the listbox rows
         list_frame = ttk.Frame(self)
         list_frame.pack(fill="both", expand=True, padx=15, pady=10)
         
-        scrollbar = ttk.Scrollbar(list_frame)
-        scrollbar.pack(side="right", fill="y")
+        self.scrollbar = ttk.Scrollbar(list_frame, command=self.on_scrollbar)
+        self.scrollbar.pack(side="right", fill="y")
         
         self.listbox = tk.Listbox(
             list_frame,
             font=("Segoe UI", 12),
-            yscrollcommand=scrollbar.set,
             bg="white",
             fg="#2c3e50",
             selectbackground="#3498db",
@@ -910,16 +878,33 @@ class FormListFrame(ttk.Frame):
             activestyle="none"  # Remove underline on selection
         )
         self.listbox.pack(side="left", fill="both", expand=True)
-        scrollbar.config(command=self.listbox.yview)
+        font = tkfont.Font(root=self, font=self.listbox.cget("font"))
+        self._row_height = (font.metrics("linespace") + 1
+                            + 2 * self.listbox.winfo_pixels(self.listbox.cget("selectborderwidth")))
         
         # Bind events - only double-click opens forms
         self.listbox.bind("<Double-Button-1>", self.on_form_double_click)
         self.listbox.bind("<Return>", self.on_form_double_click)
+        self.listbox.bind("<<ListboxSelect>>", self.on_listbox_select)
+        self.listbox.bind("<Configure>", self.on_listbox_resized)
+        for sequence in ("<MouseWheel>", "<Button-4>", "<Button-5>"):
+            self.listbox.bind(sequence, self.on_mouse_wheel)
+        for sequence, step in (("<Up>", -1), ("<Down>", 1), ("<Prior>", "-page"), ("<Next>", "page"),
+                               ("<Home>", "first"), ("<End>", "last")):
+            self.listbox.bind(sequence, lambda event, step=step: self.move_selection(step))
+        self.search_entry.bind("<Down>", lambda event: self.focus_list())
+        self.search_entry.bind("<Return>", lambda event: self.focus_list())
+        self.refresh_list()
+    
+    @property
+    def forms(self) -> List[str]:
+        """All forms of the section, in list order."""
+        return self.index.names()
     
     def suggest_next_form_name(self) -> str:
         """Suggest the next form name based on existing forms."""
         # Pattern to match: "Practice Cam XX Listening Test YY" or "Practice Cam XX Reading Test YY"
-        pattern = re.compile(r"Practice Cam (\d+) (Listening|Reading) Test (\d+)")
+        pattern = re.compile(rf"Practice Cam (\d+) ({re.escape(self.section_name)}) Test (\d+)")
         
         max_cam = 0
         cam_test_map = {}  # Map of cam_number -> max_test_number
@@ -958,8 +943,7 @@ class FormListFrame(ttk.Frame):
                 next_test = 1
         
         # Generate suggested name (2-digit format for consistency)
-        section_type = "Listening" if self.section_name == "Listening" else "Reading"
-        return f"Practice Cam {next_cam} {section_type} Test {next_test:02d}"
+        return f"Practice Cam {next_cam} {self.section_name} Test {next_test:02d}"
     
     def on_add_form(self) -> None:
         dialog = tk.Toplevel(self.winfo_toplevel())
@@ -1007,17 +991,11 @@ class FormListFrame(ttk.Frame):
     
     def on_delete_form(self) -> None:
         """Delete the selected form from the list."""
-        selection = self.listbox.curselection()
-        if not selection:
+        form_name = self.selected_form()
+        if form_name is None:
             messagebox.showinfo("No Selection", "Please select a form to delete.")
             return
         
-        idx = selection[0]
-        if idx >= len(self.forms):
-            return
-        
-        form_name = self.forms[idx]
-        
         # Confirmation dialog
         result = messagebox.askyesno(
             "Delete Form",
@@ -1027,7 +1005,8 @@ class FormListFrame(ttk.Frame):
         
         if result:
             # Remove from list
-            self.forms.remove(form_name)
+            self.index.remove(form_name)
+            self._selected = None
             self.refresh_list()
             
             # Delete form state from database
@@ -1040,14 +1019,18 @@ class FormListFrame(ttk.Frame):
     
     def get_form_status(self, form_name: str) -> str:
         """Get status of a form: 'completed', 'in-progress', or 'not-started'."""
+        return self.index.status(form_name)
+    
+    def _state_status(self, form_name: str) -> str:
+        """Status of a form from its saved state."""
         if self.get_form_state:
-            form_key = f"{self.section_name.lower()}:{form_name}"
-            state = self.get_form_state(form_key)
-            if state and state.get("score_text"):
-                return "completed"
-            elif state and (state.get("user_answers") or state.get("answer_keys")):
-                return "in-progress"
-        return "not-started"
+            return form_status(self.get_form_state(f"{self.section_id}:{form_name}"))
+        return STATUS_NOT_STARTED
+    
+    def update_status(self, form_name: str) -> None:
+        """Re-read one form's saved state after it changed; redraws only if its status did."""
+        if self.index.set_status(form_name, self._state_status(form_name)):
+            self._render()
     
     def format_listbox_item(self, form_name: str) -> str:
         """Format form name for listbox (no status icons)."""
@@ -1060,16 +1043,10 @@ class FormListFrame(ttk.Frame):
             return
         
         try:
-            selection = self.listbox.curselection()
-            if not selection:
-                return
-            
-            idx = selection[0]
-            if idx >= len(self.forms):
+            form_name = self.selected_form()
+            if form_name is None:
                 return
             
-            form_name = self.forms[idx]
-            
             # Set flag to prevent rapid clicks
             self._click_in_progress = True
             
@@ -1092,15 +1069,119 @@ class FormListFrame(ttk.Frame):
             print(f"Error in double-click handler: {e}")
     
     def add_form(self, form_name: str) -> None:
-        if form_name not in self.forms:
-            self.forms.append(form_name)
+        if self.index.add(form_name, self._state_status(form_name)):
             self.refresh_list()
     
+    def add_forms(self, form_names: Sequence[str]) -> None:
+        """Append many forms (skipping ones already listed) with a single listbox refresh."""
+        statuses = {form_name: self._state_status(form_name) for form_name in form_names}
+        self.index.add_many(form_names, statuses)
+        self.refresh_list()
+    
     def refresh_list(self) -> None:
-        """Refresh the listbox with current forms."""
+        """Re-run the search and refill the visible rows."""
+        self._shown = self.index.search(self.search_var.get())
+        self.scroll_to(self._top)
+    
+    def on_search_changed(self) -> None:
+        self._top = 0
+        self.refresh_list()
+    
+    def focus_list(self) -> str:
+        """Move focus from the search box to the list, selecting the first match if none is."""
+        if self._shown and self._selected not in self._shown[self._top:self._top + self._rows]:
+            self._selected = self._shown[self._top]
+            self._render()
+        self.listbox.focus_set()
+        return "break"
+    
+    def selected_form(self) -> Optional[str]:
+        selection = self.listbox.curselection()
+        if selection and self._top + selection[0] < len(self._shown):
+            return self._shown[self._top + selection[0]]
+        return self._selected if self._selected in self._shown else None
+    
+    def scroll_to(self, top: int) -> None:
+        """Show the filtered forms from index top on (clamped so the list stays full)."""
+        self._top = max(0, min(top, len(self._shown) - self._rows))
+        self._render()
+    
+    def _render(self) -> None:
+        # One row more than fits completely: the partly visible last row
+        rows = self._shown[self._top:self._top + self._rows + 1]
         self.listbox.delete(0, tk.END)
-        for form_name in self.forms:
-            self.listbox.insert(tk.END, form_name)
+        if rows:
+            self.listbox.insert(tk.END, *rows)
+            for row, form_name in enumerate(rows):
+                color = FORM_STATUS_COLORS.get(self.index.status(form_name))
+                if color:
+                    self.listbox.itemconfig(row, foreground=color)
+            if self._selected in rows:
+                row = rows.index(self._selected)
+                self.listbox.selection_set(row)
+                self.listbox.activate(row)
+        total = len(self._shown)
+        if total:
+            self.scrollbar.set(self._top / total, min(1.0, (self._top + self._rows) / total))
+        else:
+            self.scrollbar.set(0.0, 1.0)
+        
+        counts = self.index.counts
+        shown = f"{total} of {len(self.index)}" if total != len(self.index) else str(total)
+        self.summary_label.config(
+            text=f"{shown} forms · {counts[STATUS_COMPLETED]} completed · {counts[STATUS_IN_PROGRESS]} in progress"
+        )
+    
+    def on_listbox_select(self, event=None) -> None:
+        selection = self.listbox.curselection()
+        if selection and self._top + selection[0] < len(self._shown):
+            self._selected = self._shown[self._top + selection[0]]
+    
+    def on_listbox_resized(self, event) -> None:
+        border = self.listbox.winfo_pixels(self.listbox.cget("highlightthickness")) + \
+            self.listbox.winfo_pixels(self.listbox.cget("borderwidth"))
+        rows = max(1, (event.height - 2 * border) // self._row_height)
+        if rows != self._rows:
+            self._rows = rows
+            self.scroll_to(self._top)
+    
+    def on_scrollbar(self, action: str, amount: str, unit: str = "units") -> None:
+        if action == "moveto":
+            self.scroll_to(round(float(amount) * len(self._shown)))
+        elif action == "scroll":
+            self.scroll_to(self._top + int(amount) * (self._rows if unit == "pages" else 1))
+    
+    def on_mouse_wheel(self, event) -> str:
+        if event.num == 4 or getattr(event, "delta", 0) > 0:
+            self.scroll_to(self._top - FORM_LIST_WHEEL_ROWS)
+        else:
+            self.scroll_to(self._top + FORM_LIST_WHEEL_ROWS)
+        return "break"
+    
+    def move_selection(self, step) -> str:
+        """Arrow/page/home/end keys: move the selection over all filtered forms, scrolling to it."""
+        if not self._shown:
+            return "break"
+        try:
+            current = self._shown.index(self._selected)
+        except ValueError:
+            current = -1  # Nothing selected, or the selection is filtered out
+        if step == "first":
+            target = 0
+        elif step == "last":
+            target = len(self._shown) - 1
+        elif step in ("page", "-page"):
+            target = max(current, 0) + (self._rows if step == "page" else -self._rows)
+        else:
+            target = current + step if current >= 0 else self._top
+        target = max(0, min(target, len(self._shown) - 1))
+        self._selected = self._shown[target]
+        if target < self._top:
+            self._top = target
+        elif target >= self._top + self._rows:
+            self._top = target - self._rows + 1
+        self.scroll_to(self._top)
+        return "break"
 
 
 class IELTSApp:
@@ -1153,50 +1234,55 @@ class IELTSApp:
 
         button_frame = ttk.Frame(landing_content)
         button_frame.pack(pady=20)
-
-        listening_button = tk.Button(
-            button_frame,
-            text="Listening",
-            bg="#27ae60",
-            fg="white",
-            font=("Segoe UI", 16, "bold"),
-            width=18,
-            height=4,
-            relief="flat",
-            bd=0,
-            cursor="hand2",
-            activebackground="#229954",
-            activeforeground="white",
-            command=lambda: self.switch_to_section("listening")
-        )
-        listening_button.pack(side="left", padx=15, pady=10)
-
-        reading_button = tk.Button(
-            button_frame,
-            text="Reading",
-            bg="#e74c3c",
-            fg="white",
-            font=("Segoe UI", 16, "bold"),
-            width=18,
-            height=4,
-            relief="flat",
-            bd=0,
-            cursor="hand2",
-            activebackground="#c0392b",
-            activeforeground="white",
-            command=lambda: self.switch_to_section("reading")
-        )
-        reading_button.pack(side="left", padx=15, pady=10)
-
-        # Form list frames
-        self.listening_list = FormListFrame(self.stack_frame, "Listening", self.on_form_clicked,
-                                           get_form_state=lambda key: self.form_states.get(key),
-                                           save_callback=self.save_database,
-                                           delete_callback=lambda name: self.delete_form_state("listening", name))
-        self.reading_list = FormListFrame(self.stack_frame, "Reading", self.on_form_clicked,
-                                         get_form_state=lambda key: self.form_states.get(key),
-                                         save_callback=self.save_database,
-                                         delete_callback=lambda name: self.delete_form_state("reading", name))
+        more_frame = ttk.Frame(landing_content)
+        more_frame.pack(pady=(0, 10))
+
+        # Shown (with the section buttons disabled) until the database has been read
+        self.loading_label = ttk.Label(landing_content, text="Loading your forms…", style="Subtitle.TLabel")
+        self.loading_label.pack(pady=(0, 10))
+
+        # One landing button and one form list per test template
+        self.templates: Dict[str, TestTemplate] = {}
+        self.form_lists: Dict[str, FormListFrame] = {}
+        self.section_buttons: List[tk.Widget] = []
+        featured_count = 0
+        for template in all_templates():
+            self.templates[template.name] = template
+            if template.featured:
+                color, active_color = FEATURED_BUTTON_COLORS[featured_count % len(FEATURED_BUTTON_COLORS)]
+                featured_count += 1
+                button = tk.Button(
+                    button_frame,
+                    text=template.title,
+                    bg=color,
+                    fg="white",
+                    font=("Segoe UI", 16, "bold"),
+                    width=18,
+                    height=4,
+                    relief="flat",
+                    bd=0,
+                    cursor="hand2",
+                    activebackground=active_color,
+                    activeforeground="white",
+                    command=lambda name=template.name: self.switch_to_section(name)
+                )
+                button.pack(side="left", padx=15, pady=10)
+            else:
+                if not more_frame.winfo_children():
+                    ttk.Label(more_frame, text="More formats:", style="Subtitle.TLabel").pack(side="left", padx=5)
+                button = ttk.Button(more_frame, text=template.title, style="TButton",
+                                    command=lambda name=template.name: self.switch_to_section(name))
+                button.pack(side="left", padx=3)
+            button.configure(state="disabled")
+            self.section_buttons.append(button)
+            self.form_lists[template.name] = FormListFrame(
+                self.stack_frame, template.title, self.on_form_clicked,
+                get_form_state=lambda key: self.form_states.get(key),
+                save_callback=self.save_database,
+                delete_callback=lambda name, section=template.name: self.delete_form_state(section, name),
+                import_keys_callback=self.on_import_keys,
+                section_id=template.name,
+            )
 
         # Show landing page initially
         self.landing_frame.pack(fill="both", expand=True)
@@ -1205,38 +1291,46 @@ class IELTSApp:
         self.open_windows: Dict[str, FormWindow] = {}
         # Store form states (persists across window open/close)
         self.form_states: Dict[str, Dict] = {}
+        self.dirty_states: set = set()  # Form keys changed or deleted since the last save_database()
+        self.store: Optional[FormStore] = None  # Reads and the key library; form states are written by self.writer
+        self.writer: Optional[StoreWriter] = None
+        self._save_failure_shown = False  # The current run of failed saves was already reported
+        self.journal = EditJournal(FORMS_JOURNAL_FILE)
+        # Hidden, reset form windows ready to be rebound to another form
+        self.window_pool: Dict[str, List[FormWindow]] = {name: [] for name in self.templates}
+        # Form windows whose timer is running; one shared after() wakes only for these
+        self.running_timers: Set[FormWindow] = set()
+        self._timer_after_id: Optional[str] = None
         
         # Save database when app closes
         self.root.protocol("WM_DELETE_WINDOW", self.on_app_close)
         
-        # Load saved data from JSON database (after form lists are created)
-        self.load_database()
-        
         # Auto-size window
         self.root.update_idletasks()
         width = max(self.root.winfo_reqwidth() + 20, 600)
         height = max(self.root.winfo_reqheight() + 20, 500)
         self.root.geometry(f"{width}x{height}")
+        self._window_ready_ms = (time.perf_counter() - PROCESS_STARTED_AT) * 1000
+        
+        # Read saved data in the background while the landing page is already on screen
+        self.load_database()
+        self.root.after(JOURNAL_COMPACT_MS, self.compact_journal)
+        self.root.after_idle(self.prewarm_window_pool)
 
     def switch_to_section(self, target: str) -> None:
-        if target not in {"listening", "reading"}:
+        if target not in self.form_lists:
             return
         self.current_section = target
 
         # Hide all frames
         self.landing_frame.pack_forget()
-        self.listening_list.pack_forget()
-        self.reading_list.pack_forget()
+        for form_list in self.form_lists.values():
+            form_list.pack_forget()
 
         # Show selected section list
-        if target == "listening":
-            self.listening_list.pack(fill="both", expand=True)
-            self.listening_list.refresh_list()  # Refresh to show updated status
-        else:
-            self.reading_list.pack(fill="both", expand=True)
-            self.reading_list.refresh_list()  # Refresh to show updated status
+        self.form_lists[target].pack(fill="both", expand=True)  # Statuses are kept current by set_form_state
 
-        self.root.title(f"IELTS Answer Form · {target.capitalize()}")
+        self.root.title(f"IELTS Answer Form · {self.templates[target].title}")
         self.back_button.state(["!disabled"])
         
         # Auto-resize window
@@ -1248,8 +1342,8 @@ class IELTSApp:
     def on_back_clicked(self) -> None:
         self.current_section = None
         self.landing_frame.pack(fill="both", expand=True)
-        self.listening_list.pack_forget()
-        self.reading_list.pack_forget()
+        for form_list in self.form_lists.values():
+            form_list.pack_forget()
         self.root.title("IELTS Answer Form")
         self.back_button.state(["disabled"])
         
@@ -1260,79 +1354,323 @@ class IELTSApp:
         self.root.geometry(f"{width}x{height}")
 
     def load_database(self) -> None:
-        """Load form states and form lists from JSON database."""
+        """Read form states and form lists on a background thread; _finish_loading shows them."""
+        sections = list(self.form_lists)
+        result: Dict = {}
+        
+        def read() -> None:
+            try:
+                # First run after upgrading imports forms.json once
+                store = FormStore(FORMS_SQLITE_FILE, legacy_json=FORMS_DB_FILE)
+                try:
+                    result["states"] = store.load_states()
+                    result["forms"] = {section: store.load_forms(section) for section in sections}
+                finally:
+                    store.close()  # The connection belongs to this thread
+                # Recover edits made after the last save (e.g. the app crashed)
+                result["replayed"] = self.journal.replay(result["states"])
+            except Exception as e:
+                result["error"] = e
+        
+        loader = threading.Thread(target=read, name="ielts-store-loader", daemon=True)
+        loader.start()
+        self._poll_database_load(loader, result)
+    
+    def _poll_database_load(self, loader: threading.Thread, result: Dict) -> None:
+        if loader.is_alive():
+            self.root.after(DATABASE_POLL_MS, self._poll_database_load, loader, result)
+            return
+        self._finish_loading(result)
+    
+    def _finish_loading(self, result: Dict) -> None:
+        """Show what the background load read, then enable the section buttons."""
+        load_error: Optional[Exception] = None
         try:
-            if FORMS_DB_FILE.exists():
-                with open(FORMS_DB_FILE, "r", encoding="utf-8") as f:
-                    data = json.load(f)
-                    
-                # Load form states
-                self.form_states = data.get("form_states", {})
-                
-                # Load form lists
-                listening_forms = data.get("listening_forms", [])
-                reading_forms = data.get("reading_forms", [])
-                
-                # Restore form lists
-                for form_name in listening_forms:
-                    if form_name not in self.listening_list.forms:
-                        self.listening_list.add_form(form_name)
-                
-                for form_name in reading_forms:
-                    if form_name not in self.reading_list.forms:
-                        self.reading_list.add_form(form_name)
+            if "error" in result:
+                raise result["error"]
+            self.store = FormStore(FORMS_SQLITE_FILE)
+            self.writer = StoreWriter(FORMS_SQLITE_FILE)
+            self.root.after(WRITER_CHECK_MS, self.check_writer)
+            self.form_states = result["states"]
+            
+            # Restore form lists, one listbox insert per section
+            for section, form_names in result["forms"].items():
+                self.form_lists[section].add_forms(form_names)
+            
+            # Fold recovered journal edits into the database
+            if result["replayed"]:
+                self.dirty_states.update(result["replayed"])
+                self.save_database()
         except (json.JSONDecodeError, IOError, Exception) as e:
-            # If file is corrupted or doesn't exist, start fresh
+            # If the database is corrupted or can't be opened, start fresh
             print(f"Warning: Could not load database: {e}")
             self.form_states = {}
+            load_error = e
+        
+        self.loading_label.pack_forget()
+        for button in self.section_buttons:
+            button.configure(state="normal")
+        # Startup-time metric: process start until the section buttons accept clicks
+        form_count = sum(len(form_list.forms) for form_list in self.form_lists.values())
+        interactive_ms = (time.perf_counter() - PROCESS_STARTED_AT) * 1000
+        print(f"Startup: interactive in {interactive_ms:.0f} ms "
+              f"(window shown in {self._window_ready_ms:.0f} ms, {form_count} forms loaded)")
+        if self.writer is None:
+            # Without a writer nothing typed or submitted this session can be saved; say so up front
+            messagebox.showwarning(
+                "Database Unavailable",
+                f"The form database could not be opened:\n{load_error}\n\n"
+                "You can keep working, but forms, answers and submitted attempts "
+                "will not be saved in this session.",
+            )
+    
+    def set_form_state(self, form_key: str, state: Dict) -> None:
+        """Update a form's state in memory; it is written on the next save_database()."""
+        self.form_states[form_key] = state
+        self.dirty_states.add(form_key)
+        section, _, form_name = form_key.partition(":")
+        if section in self.form_lists:
+            self.form_lists[section].update_status(form_name)
     
     def save_database(self) -> None:
-        """Save form states and form lists to JSON database."""
+        """Hand changed form states and form lists to the background writer; never waits for disk."""
         try:
             # Save all open windows' states before saving
             for form_key, form_window in list(self.open_windows.items()):
                 try:
-                    self.form_states[form_key] = form_window.save_state()
+                    self.set_form_state(form_key, form_window.save_state())
                 except (tk.TclError, AttributeError):
                     pass  # Window was destroyed
             
-            data = {
-                "form_states": self.form_states,
-                "listening_forms": self.listening_list.forms,
-                "reading_forms": self.reading_list.forms
-            }
+            if self.writer is None:
+                return
             
-            # Write to temporary file first, then rename (atomic write)
-            temp_file = FORMS_DB_FILE.with_suffix(".json.tmp")
-            with open(temp_file, "w", encoding="utf-8") as f:
-                json.dump(data, f, indent=2, ensure_ascii=False)
+            # States in form_states are replaced, never mutated, so they can be handed over as they are;
+            # a dirty key without a state was deleted
+            states = {form_key: self.form_states.get(form_key) for form_key in self.dirty_states}
+            self.dirty_states.clear()
+            forms = {section: form_list.forms for section, form_list in self.form_lists.items()}
             
-            # Atomic replace (cross-platform, Python 3.3+)
-            os.replace(str(temp_file), str(FORMS_DB_FILE))
+            # Journaled edits so far are dropped once this snapshot is in the database
+            mark = self.journal.checkpoint()
+            self.writer.submit(states, forms, on_written=lambda: self.journal.discard(mark))
         except (IOError, Exception) as e:
             print(f"Warning: Could not save database: {e}")
     
+    def record_edit(self, form_key: str, field: str, index: int, value: str) -> None:
+        """Journal a single typed edit from an open form."""
+        try:
+            self.journal.record_edit(form_key, field, index, value)
+        except OSError as e:
+            print(f"Warning: Could not write journal: {e}")
+    
+    def record_form_state(self, form_key: str, form_window: "FormWindow") -> None:
+        """Journal a form's whole state after a bulk change."""
+        try:
+            self.journal.record_state(form_key, form_window.save_state())
+        except (OSError, tk.TclError) as e:
+            print(f"Warning: Could not write journal: {e}")
+    
+    def record_attempt(self, form_key: str, form_window: "FormWindow", correct: int, evaluated: int) -> None:
+        """Keep a submitted attempt in the form's history (written by the background writer)."""
+        state = form_window.save_state()
+        self.set_form_state(form_key, state)
+        if self.writer is None:
+            return
+        submitted_at = datetime.now().isoformat(timespec="seconds")
+        try:
+            self.writer.submit({}, {}, attempts=[Attempt(form_key, submitted_at, correct, evaluated, state)])
+        except RuntimeError as e:
+            print(f"Warning: Could not save attempt: {e}")
+    
+    def _save_synchronously(self) -> bool:
+        """Write what the background writer could not, on this thread; True if it was saved."""
+        states, forms, attempts, callbacks = self.writer.take_pending()
+        if self.store is None:
+            return False
+        try:
+            self.store.apply_changes(states, forms, attempts)
+        except Exception as e:
+            print(f"Warning: Could not save database: {e}")
+            return False
+        for callback in callbacks:
+            try:
+                callback()
+            except OSError as e:
+                print(f"Warning: Could not finish saving: {e}")
+        return True
+    
+    def check_writer(self) -> None:
+        """Tell the user once when background saves start failing (the writer keeps retrying)."""
+        failure = self.writer.failure if self.writer is not None else None
+        if failure is None:
+            self._save_failure_shown = False
+        elif not self._save_failure_shown:
+            self._save_failure_shown = True
+            messagebox.showwarning(
+                "Saving Failed",
+                f"Your changes could not be saved to the form database:\n{failure}\n\n"
+                "The app keeps retrying. Typed edits are also kept in the edit journal "
+                "and are recovered the next time the app starts.",
+            )
+        self.root.after(WRITER_CHECK_MS, self.check_writer)
+    
+    def compact_journal(self) -> None:
+        """Periodically fold journaled edits into the database."""
+        if self.journal.has_records():
+            self.save_database()
+        self.root.after(JOURNAL_COMPACT_MS, self.compact_journal)
+    
     def delete_form_state(self, section: str, form_name: str) -> None:
         """Delete form state from database."""
         form_key = f"{section}:{form_name}"
         
-        # Remove from form_states
-        if form_key in self.form_states:
-            del self.form_states[form_key]
+        # Remove from form_states; the next save_database() deletes its row
+        self.form_states.pop(form_key, None)
+        self.dirty_states.add(form_key)
+        try:
+            self.journal.record_delete(form_key)
+        except OSError as e:
+            print(f"Warning: Could not write journal: {e}")
         
         # Close window if it's open
         if form_key in self.open_windows:
-            try:
-                self.open_windows[form_key].window.destroy()
-            except (tk.TclError, AttributeError):
-                pass
-            del self.open_windows[form_key]
+            self.release_form_window(section, self.open_windows.pop(form_key))
+    
+    def attach_library_key(self, section: str, form_name: str, form_window: FormWindow) -> bool:
+        """Fill in a form's answer keys from the key library. Returns True if a key was found."""
+        if self.store is None:
+            return False
+        try:
+            key = self.store.key_library.lookup_form(section, form_name)
+        except Exception as e:
+            print(f"Warning: Could not look up answer key for {form_name}: {e}")
+            return False
+        if key is None:
+            return False
+        form_window.section_box.apply_answer_keys(*key)
+        return True
+    
+    def on_import_keys(self) -> None:
+        """Import a folder of answer key files into the key library."""
+        if self.store is None:
+            messagebox.showerror("Import Keys", "The form database is not available.")
+            return
+        directory = filedialog.askdirectory(title="Choose a folder of answer key files")
+        if not directory:
+            return
+        try:
+            imported, skipped = self.store.key_library.import_directory(Path(directory))
+        except Exception as e:
+            messagebox.showerror("Import Keys", f"Could not import keys:\n{e}")
+            return
+        summary = f"Imported {imported} answer key(s)."
+        if skipped:
+            names = "\n".join(os.path.basename(path) for path in skipped[:10])
+            more = f"\n… and {len(skipped) - 10} more" if len(skipped) > 10 else ""
+            summary += (f"\n\nSkipped {len(skipped)} file(s) without a Cam/section/test name "
+                        f"or numbered answers:\n{names}{more}")
+        messagebox.showinfo("Import Keys", summary)
     
     def on_app_close(self) -> None:
         """Handle app close - save database before exiting."""
         self.save_database()
+        self.root.withdraw()  # Gone from the screen while the last write finishes
+        if (self.writer is not None and not self.writer.close(WRITER_CLOSE_TIMEOUT)
+                and not self._save_synchronously()):
+            messagebox.showerror(
+                "Saving Failed",
+                "Some changes could not be saved to the form database. Typed edits are kept "
+                "in the edit journal and will be recovered the next time the app starts.",
+            )
+        if self.store is not None:
+            self.store.close()
+        self.journal.close()
         self.root.destroy()
 
+    def on_timer_state_changed(self, form_window: FormWindow) -> None:
+        """Track which windows have a running timer and re-plan the next tick."""
+        if form_window.timer_running:
+            self.running_timers.add(form_window)
+        else:
+            self.running_timers.discard(form_window)
+        self.schedule_timer_tick()
+    
+    def schedule_timer_tick(self, delay: Optional[float] = None) -> None:
+        """Wake up once, when the soonest running timer's displayed second changes."""
+        if self._timer_after_id is not None:
+            self.root.after_cancel(self._timer_after_id)
+            self._timer_after_id = None
+        if not self.running_timers:
+            return  # Nothing to draw; no wakeups at all
+        if delay is None:
+            delay = 0.0  # Draw newly started timers right away
+        self._timer_after_id = self.root.after(max(int(delay * 1000) + TIMER_TICK_SLACK_MS, 1), self.on_timer_tick)
+    
+    def on_timer_tick(self) -> None:
+        self._timer_after_id = None
+        now = datetime.now()
+        next_delay: Optional[float] = None
+        for form_window in list(self.running_timers):
+            try:
+                delay = form_window.tick_timer(now)
+            except tk.TclError:
+                delay = None  # Window was destroyed
+            if delay is None:
+                self.running_timers.discard(form_window)
+            elif next_delay is None or delay < next_delay:
+                next_delay = delay
+        if next_delay is not None:
+            self.schedule_timer_tick(next_delay)
+    
+    def create_form_window(self, section: str, form_name: str, start_hidden: bool = False) -> FormWindow:
+        form_window = FormWindow(self.root, form_name, self.templates[section], start_hidden=start_hidden)
+        form_window.timer_state_callback = self.on_timer_state_changed
+        return form_window
+    
+    def prewarm_window_pool(self) -> None:
+        """Build one hidden window per featured section while idle so the first open is instant."""
+        for section, pool in self.window_pool.items():
+            if pool or not self.templates[section].featured:
+                continue
+            try:
+                pool.append(self.create_form_window(section, "", start_hidden=True))
+            except tk.TclError as e:
+                print(f"Warning: Could not pre-build {section} window: {e}")
+    
+    def acquire_form_window(self, section: str, form_name: str) -> FormWindow:
+        """Take a pooled window for the section (or build one) and show it for form_name."""
+        pool = self.window_pool[section]
+        while pool:
+            form_window = pool.pop()
+            try:
+                if not form_window.window.winfo_exists():
+                    continue
+                form_window.bind_form(form_name)
+                form_window.window.deiconify()
+                form_window.window.lift()
+                form_window.window.focus()
+                return form_window
+            except tk.TclError:
+                continue  # Destroyed behind our back; try the next one
+        return self.create_form_window(section, form_name)
+    
+    def release_form_window(self, section: str, form_window: FormWindow) -> None:
+        """Hide and reset a closed form window for reuse, or destroy it if the pool is full."""
+        self.running_timers.discard(form_window)
+        try:
+            pool = self.window_pool[section]
+            if form_window in pool:
+                return
+            if len(pool) < FORM_WINDOW_POOL_SIZE:
+                form_window.window.withdraw()
+                form_window.reset()
+                pool.append(form_window)
+                return
+            form_window.window.destroy()
+        except (tk.TclError, AttributeError):
+            pass  # Window already destroyed
+    
     def on_form_clicked(self, form_name: str) -> None:
         """Open or focus a form window."""
         if not self.current_section:
@@ -1358,43 +1696,10 @@ class IELTSApp:
                 if form_key in self.open_windows:
                     del self.open_windows[form_key]
         
-        # Create groups based on section and set appropriate window sizes
-        if self.current_section == "listening":
-            groups = [
-                (f"Listening Part {idx} (Q{(idx - 1) * 10 + 1}-{idx * 10})", 10)
-                for idx in range(1, 5)
-            ]
-            section_name = "Listening"
-            # Listening has 4 columns, needs wider window
-            default_width = 1200
-            default_height = 700
-            min_width = 1000
-            min_height = 600
-        else:
-            groups = [
-                ("Reading Passage 1 (Q1-13)", 13),
-                ("Reading Passage 2 (Q14-26)", 13),
-                ("Reading Passage 3 (Q27-40)", 14),
-            ]
-            section_name = "Reading"
-            # Reading has 3 columns, can be narrower
-            default_width = 1000
-            default_height = 700
-            min_width = 900
-            min_height = 600
-        
-        # Create new form window with section-specific sizes
+        # Reuse a pooled window for this section if there is one
+        section = self.current_section
         try:
-            form_window = FormWindow(
-                self.root, 
-                form_name, 
-                section_name, 
-                groups,
-                default_width=default_width,
-                default_height=default_height,
-                min_width=min_width,
-                min_height=min_height
-            )
+            form_window = self.acquire_form_window(section, form_name)
             self.open_windows[form_key] = form_window
             
             # Load saved state if exists
@@ -1404,27 +1709,32 @@ class IELTSApp:
                 except Exception as e:
                     print(f"Warning: Could not load state for {form_name}: {e}")
             
+            # Attach the form's official key from the key library if it has none yet
+            if not any(form_window.section_box.get_answer_keys()):
+                self.attach_library_key(section, form_name, form_window)
+            
+            # Journal edits so a crash doesn't lose the session
+            form_window.section_box.edit_callback = (
+                lambda field, index, value: self.record_edit(form_key, field, index, value)
+            )
+            form_window.state_changed_callback = lambda: self.record_form_state(form_key, form_window)
+            form_window.attempt_callback = (
+                lambda correct, evaluated: self.record_attempt(form_key, form_window, correct, evaluated)
+            )
+            
             # Clean up when window closes
             def on_close():
                 try:
                     # Save state before closing
                     if form_key in self.open_windows:
                         try:
-                            self.form_states[form_key] = form_window.save_state()
+                            self.set_form_state(form_key, form_window.save_state())
                         except Exception:
                             pass  # Ignore save errors on close
                         del self.open_windows[form_key]
-                        # Refresh the form list to update status
-                        if self.current_section == "listening":
-                            self.listening_list.refresh_list()
-                        elif self.current_section == "reading":
-                            self.reading_list.refresh_list()
                         # Save to database
                         self.save_database()
-                    try:
-                        form_window.window.destroy()
-                    except (tk.TclError, AttributeError):
-                        pass  # Window already destroyed
+                    self.release_form_window(section, form_window)
                 except Exception as e:
                     print(f"Error in window close handler: {e}")
             
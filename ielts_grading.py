@@ -0,0 +1,650 @@
+#!/usr/bin/env python3
+"""Grading core for the IELTS answer form (no tkinter dependency).
+
+The functions here are shared by the Tkinter UI and any headless tooling.
+If the optional ``_ielts_native`` extension has been built (see
+``setup_native.py``), the hot paths are swapped for the compiled versions,
+which return exactly the same verdicts as the pure Python code below.
+"""
+
+import itertools
+import os
+import re
+from functools import lru_cache
+from typing import Callable, Dict, FrozenSet, Iterable, Iterator, List, NamedTuple, Optional, Sequence, Tuple
+
+from ielts_canonical import canonicalize_answer, key_spellings
+
+NUM_QUESTIONS = 40
+
+# Near misses: a wrong answer within 1 edit of a key spelling (2 edits from
+# NEAR_MISS_LONG_LENGTH characters on); keys shorter than the minimum never count
+NEAR_MISS_MIN_LENGTH = 4
+NEAR_MISS_LONG_LENGTH = 9
+
+# Band conversion tables live in bands/<section>_<scheme>.txt, or bands/<section>.txt
+# when every scheme shares one (Listening). See load_band_table for the format.
+BAND_SCHEMES_DIR = os.path.join(os.path.dirname(os.path.abspath(__file__)), "bands")
+BAND_SCHEMES = ("academic", "general")
+DEFAULT_BAND_SCHEME = "academic"
+
+
+def py_normalize_answer(answer: str) -> str:
+    """Normalize answers for comparison (case/spacing insensitive)."""
+    cleaned = re.sub(r"[\s\-]+", "", answer.strip().lower())
+    return cleaned
+
+
+def py_is_answer_correct(user_answer: str, key_answer: str) -> bool:
+    """Check if user answer matches the key answer.
+
+    The key answer may contain multiple options separated by "/" (e.g., "gardens / gardening").
+    If the user provides any of these options, it's considered correct.
+    """
+    user_normalized = py_normalize_answer(user_answer)
+
+    # Split key answer by "/" to get multiple acceptable options
+    key_options = [opt.strip() for opt in key_answer.split("/")]
+
+    # Check if user's normalized answer matches any of the key options
+    for key_option in key_options:
+        if user_normalized == py_normalize_answer(key_option):
+            return True
+
+    return False
+
+
+def py_match_shared_group(user_answers: Sequence[str], key_answer: str) -> List[bool]:
+    """Match a shared group's answers (e.g. "21&22 B, D") without replacement.
+
+    The key is the comma-separated option list stored for the group; an option
+    may list "/"-separated alternatives. Each option can only be used once, so
+    the best assignment of answers to options is found (earlier answers win
+    ties); returns one verdict per user answer, in order.
+    """
+    option_masks = _option_masks(key_answer, py_normalize_answer)
+    return _match_options([option_masks.get(py_normalize_answer(answer), 0) for answer in user_answers])
+
+
+def _option_masks(key_answer: str, normalize: Callable[[str], str]) -> Dict[str, int]:
+    """Normalized answer -> bitmask of the group options (bit i = i-th option) that accept it.
+
+    Listing an option twice gives two options, so it may be matched twice.
+    Blank alternatives are dropped; a blank answer never scores in a group.
+    """
+    option_masks: Dict[str, int] = {}
+    options = [opt.strip() for opt in key_answer.split(",") if opt.strip()]
+    for index, option in enumerate(options):
+        for alternative in option.split("/"):
+            alternative_normalized = normalize(alternative.strip())
+            if alternative_normalized:
+                option_masks[alternative_normalized] = option_masks.get(alternative_normalized, 0) | (1 << index)
+    return option_masks
+
+
+def _match_options(answer_masks: Sequence[int]) -> List[bool]:
+    """Maximum matching of answers to options; answer_masks[i] holds the options answer i may take.
+
+    Answers are placed in order and a placed answer is never dropped again
+    (only moved to another option along an augmenting path), so when not every
+    answer can score, the earlier ones do.
+    """
+    owner: Dict[int, int] = {}  # Option bit -> index of the answer holding it
+    used = 0  # Options taken so far
+    seen = 0  # Options already tried while placing the current answer
+
+    def place(answer: int, mask: int) -> bool:
+        nonlocal used, seen
+        free = mask & ~used
+        if free:
+            bit = free & -free
+            used |= bit
+            owner[bit] = answer
+            return True
+        candidates = mask & ~seen
+        seen |= mask
+        while candidates:
+            bit = candidates & -candidates
+            candidates ^= bit
+            holder = owner[bit]
+            if place(holder, answer_masks[holder] & ~bit):
+                owner[bit] = answer
+                return True
+        return False
+
+    verdicts: List[bool] = []
+    for answer, mask in enumerate(answer_masks):
+        seen = 0
+        verdicts.append(bool(mask) and place(answer, mask))
+    return verdicts
+
+
+try:
+    from _ielts_native import (  # type: ignore[import-not-found]
+        is_answer_correct,
+        match_shared_group,
+        normalize_answer,
+    )
+    HAVE_NATIVE = True
+except ImportError:
+    normalize_answer = py_normalize_answer
+    is_answer_correct = py_is_answer_correct
+    match_shared_group = py_match_shared_group
+    HAVE_NATIVE = False
+
+
+def load_band_table(path: str, max_score: int = NUM_QUESTIONS) -> Tuple[float, ...]:
+    """Compile a band file into a direct-index table: table[raw score] = band.
+
+    Each non-comment line holds the lowest raw score for a band and the band
+    ("30 7.0"); scores below every threshold get 0.0.
+    """
+    thresholds: List[Tuple[int, float]] = []
+    with open(path, "r", encoding="utf-8") as handle:
+        for line_number, raw_line in enumerate(handle, start=1):
+            line = raw_line.split("#", 1)[0].strip()
+            if not line:
+                continue
+            try:
+                score_text, band_text = line.split()
+                thresholds.append((int(score_text), float(band_text)))
+            except ValueError:
+                raise ValueError(f"{path}:{line_number}: expected '<raw score> <band>', got {line!r}") from None
+    table = [0.0] * (max_score + 1)
+    for threshold, band in sorted(thresholds):
+        for score in range(max(threshold, 0), max_score + 1):
+            table[score] = band
+    return tuple(table)
+
+
+@lru_cache(maxsize=None)
+def band_table(section_name: str, scheme: Optional[str] = None) -> Tuple[float, ...]:
+    """The compiled table for a section ("Listening" or anything else = Reading) and scheme.
+
+    Tables are read from BAND_SCHEMES_DIR once and cached.
+    """
+    section = "listening" if section_name.lower() == "listening" else "reading"
+    scheme = (scheme or DEFAULT_BAND_SCHEME).lower()
+    for name in (f"{section}_{scheme}", section):
+        path = os.path.join(BAND_SCHEMES_DIR, f"{name}.txt")
+        if os.path.isfile(path):
+            return load_band_table(path)
+    raise ValueError(f"No band scheme {scheme!r} for {section} in {BAND_SCHEMES_DIR}")
+
+
+def lookup_band(section_name: str, correct: int, scheme: Optional[str] = None) -> float:
+    table = band_table(section_name, scheme)
+    return table[min(max(correct, 0), len(table) - 1)]
+
+
+def bands_for(section_name: str, scheme: Optional[str], counts: Iterable[int]) -> List[float]:
+    """Bands for many raw scores at once (one table fetch, then one index per score)."""
+    table = band_table(section_name, scheme)
+    top = len(table) - 1
+    return [table[count] if 0 <= count <= top else table[0 if count < 0 else top] for count in counts]
+
+
+QUESTION_LINE_RE = re.compile(r"^(\d+(?:&\d+)*)(?:[.)-])?\s+(.*)$")
+SECTION_LINE_RE = re.compile(r"^(part|passage)\b", re.IGNORECASE)
+TEST_HEADING_RE = re.compile(r"\btest\s*[_\-]?\s*\d+", re.IGNORECASE)
+ANSWER_SPLIT_RE = re.compile(r"[,;]")
+# "NO MORE THAN TWO WORDS AND/OR A NUMBER", "ONE WORD ONLY", ... on an instruction line
+WORD_LIMIT_INSTRUCTION_RE = re.compile(
+    r"\b(?:no\s+more\s+than\s+)?(one|two|three|four|five|\d+)\s+words?\b(\s+and\s*/\s*or\s+a\s+number)?",
+    re.IGNORECASE,
+)
+LIMIT_WORDS = {"one": 1, "two": 2, "three": 3, "four": 4, "five": 5}
+
+# Key grammar (single questions): "/" separates alternatives, "(...)" marks
+# optional words that may themselves hold "/" choices, and a trailing
+# "[2 words]" or "[2 words + number]" typed into a key drops spellings over
+# the word limit. Limits from a pasted key's instructions are kept apart from
+# the key text, as word_limits (see parse_answer_text).
+KEY_WORD_LIMIT_RE = re.compile(r"\s*\[(\d+) words?( \+ number)?\]$", re.IGNORECASE)
+KEY_ALTERNATIVE_SPLIT_RE = re.compile(r"/(?![^()]*\))")  # "/" outside parentheses
+KEY_OPTIONAL_RE = re.compile(r"\(([^()]*)\)")
+MAX_KEY_VARIANTS = 256  # Per alternative; beyond this the parentheses are taken literally
+
+
+class WordLimit(NamedTuple):
+    """Most words an answer may have, as set by an instruction like "NO MORE THAN TWO WORDS"."""
+
+    words: int
+    numbers_free: bool  # "... AND/OR A NUMBER": numbers don't count towards the limit
+
+
+class AnswerTest(NamedTuple):
+    """One test's key as found by iter_answer_tests."""
+
+    heading: str  # Line that introduced the test (e.g. "Cam 10 Listening Test 1"), or ""
+    mapping: Dict[int, str]
+    shared_groups: Dict[int, List[int]]
+    word_limits: Dict[int, WordLimit]
+
+
+def _word_limit_instruction(line: str) -> Optional[WordLimit]:
+    """The word limit an instruction line sets, or None."""
+    match = WORD_LIMIT_INSTRUCTION_RE.search(line)
+    if not match:
+        return None
+    count = match.group(1).lower()
+    limit = LIMIT_WORDS[count] if count in LIMIT_WORDS else int(count)
+    if limit < 1:
+        return None
+    return WordLimit(limit, bool(match.group(2)))
+
+
+def _parse_question_line(line: str, question_total: int) -> Optional[Tuple[List[int], str]]:
+    """Split a stripped "21&22 B, D" line into (question numbers, key text), or None."""
+    match = QUESTION_LINE_RE.match(line)
+    if not match:
+        return None
+    answer_blob = match.group(2).strip()
+    if not answer_blob:
+        return None
+
+    # Parse answers - split by comma or semicolon
+    answers = [ans.strip() for ans in ANSWER_SPLIT_RE.split(answer_blob) if ans.strip()]
+    if not answers:
+        answers = [answer_blob]
+
+    # Parse question numbers
+    question_numbers = []
+    for token in match.group(1).split("&"):
+        qnum = int(token)
+        if 1 <= qnum <= question_total:
+            question_numbers.append(qnum)
+    if not question_numbers:
+        return None
+
+    if len(question_numbers) > 1:
+        # Shared group answers are matched without replacement, so keep them comma-separated
+        return question_numbers, ", ".join(answers)
+    # Single question - join multiple options with " / " if multiple answers
+    return question_numbers, " / ".join(answers)
+
+
+def _store_question_line(mapping: Dict[int, str], shared_groups: Dict[int, List[int]],
+                         word_limits: Dict[int, WordLimit], question_numbers: List[int], answer: str,
+                         word_limit: Optional[WordLimit]) -> None:
+    if len(question_numbers) > 1:
+        for qnum in question_numbers:
+            shared_groups[qnum] = question_numbers.copy()
+    for qnum in question_numbers:
+        mapping[qnum] = answer
+        # Only single questions take the instruction's limit, and a key's own "[N words]" wins
+        if word_limit is not None and len(question_numbers) == 1 and not KEY_WORD_LIMIT_RE.search(answer):
+            word_limits[qnum] = word_limit
+        else:
+            word_limits.pop(qnum, None)
+
+
+def parse_answer_text(text: str, question_total: int = NUM_QUESTIONS
+                      ) -> Tuple[Dict[int, str], Dict[int, List[int]], Dict[int, WordLimit]]:
+    """Parse pasted answer text into a question->answer mapping.
+
+    Returns:
+        Tuple of (mapping, shared_groups, word_limits):
+        - mapping: Dict[int, str] - question number to answer string
+        - shared_groups: Dict[int, List[int]] - question number to list of questions in same group
+        - word_limits: Dict[int, WordLimit] - question number to the instruction's word limit
+
+    Handles formats like:
+    - "21 B" -> question 21 has answer B
+    - "21&22 B, D" -> questions 21 and 22 share answers B, D (each answer can only be used once)
+    - "23&24&25 A, B, C" -> questions 23, 24, 25 share answers A, B, C
+    - "5 (the) library" -> "library" or "the library" (see compile_answer_key)
+
+    An instruction line such as "(Write NO MORE THAN TWO WORDS)" sets a
+    two-word limit for the single-question keys after it, until the next
+    instruction or Part/Passage line. The key text itself is left as written.
+    """
+    mapping: Dict[int, str] = {}
+    shared_groups: Dict[int, List[int]] = {}  # Maps question to list of questions in its group
+    word_limits: Dict[int, WordLimit] = {}
+    word_limit: Optional[WordLimit] = None
+
+    for raw_line in text.splitlines():
+        line = raw_line.strip()
+        if not line:
+            continue
+        parsed = None
+        if not line.startswith("(") and not SECTION_LINE_RE.match(line):
+            parsed = _parse_question_line(line, question_total)
+        if parsed is not None:
+            _store_question_line(mapping, shared_groups, word_limits, *parsed, word_limit)
+            continue
+        instruction = _word_limit_instruction(line)
+        if instruction is not None or SECTION_LINE_RE.match(line):
+            word_limit = instruction
+
+    return mapping, shared_groups, word_limits
+
+
+def iter_answer_tests(lines: Iterable[str], question_total: int = NUM_QUESTIONS) -> Iterator[AnswerTest]:
+    """Stream the tests out of a key file holding one or many of them.
+
+    lines is any line iterator, typically an open text file, and only the test
+    being read is held in memory. A new test starts at a heading line naming a
+    test (e.g. "Cambridge 12 Reading Test 3") or when a question number repeats.
+    Lines are read with the same rules as parse_answer_text; tests without any
+    answers are not yielded.
+    """
+    heading = ""
+    mapping: Dict[int, str] = {}
+    shared_groups: Dict[int, List[int]] = {}
+    word_limits: Dict[int, WordLimit] = {}
+    word_limit: Optional[WordLimit] = None
+
+    for raw_line in lines:
+        line = raw_line.strip()
+        if not line:
+            continue
+        parsed = None
+        if not line.startswith("(") and not SECTION_LINE_RE.match(line):
+            parsed = _parse_question_line(line, question_total)
+        if parsed is None:
+            instruction = _word_limit_instruction(line)
+            if instruction is not None or SECTION_LINE_RE.match(line):
+                word_limit = instruction
+            elif TEST_HEADING_RE.search(line) and not line.startswith("("):
+                if mapping:
+                    yield AnswerTest(heading, mapping, shared_groups, word_limits)
+                    mapping, shared_groups, word_limits = {}, {}, {}
+                heading, word_limit = line, None
+            continue
+        if any(qnum in mapping for qnum in parsed[0]):
+            # Numbering restarted without a heading: the previous test is complete
+            yield AnswerTest(heading, mapping, shared_groups, word_limits)
+            heading, mapping, shared_groups, word_limits, word_limit = "", {}, {}, {}, None
+        _store_question_line(mapping, shared_groups, word_limits, *parsed, word_limit)
+
+    if mapping:
+        yield AnswerTest(heading, mapping, shared_groups, word_limits)
+
+
+class NearForm(NamedTuple):
+    """An accepted spelling with its bit-parallel match table, for near-miss checks."""
+
+    text: str
+    char_masks: Dict[str, int]  # Character -> bitmask of its positions in text
+    max_distance: int
+
+
+def _near_form(text: str) -> NearForm:
+    char_masks: Dict[str, int] = {}
+    for position, ch in enumerate(text):
+        char_masks[ch] = char_masks.get(ch, 0) | (1 << position)
+    return NearForm(text, char_masks, 1 if len(text) < NEAR_MISS_LONG_LENGTH else 2)
+
+
+def _within_distance(form: NearForm, text: str) -> bool:
+    """Whether the Levenshtein distance between form.text and text is at most form.max_distance.
+
+    Myers/Hyyrö bit-parallel algorithm: the last column of the DP matrix is
+    advanced one character of text at a time as bit vectors, and the loop
+    stops as soon as the distance can no longer come back within the bound.
+    """
+    length = len(form.text)
+    limit = form.max_distance
+    remaining = len(text)
+    if abs(remaining - length) > limit:
+        return False
+    full = (1 << length) - 1
+    last = 1 << (length - 1)
+    plus_vertical = full
+    minus_vertical = 0
+    distance = length
+    for ch in text:
+        remaining -= 1
+        equal = form.char_masks.get(ch, 0)
+        cross_vertical = equal | minus_vertical
+        cross_horizontal = (((equal & plus_vertical) + plus_vertical) ^ plus_vertical) | equal
+        plus_horizontal = minus_vertical | ~(cross_horizontal | plus_vertical)
+        minus_horizontal = plus_vertical & cross_horizontal
+        if plus_horizontal & last:
+            distance += 1
+        elif minus_horizontal & last:
+            distance -= 1
+        if distance - remaining > limit:
+            return False
+        plus_horizontal = ((plus_horizontal << 1) | 1) & full
+        minus_horizontal = (minus_horizontal << 1) & full
+        plus_vertical = (minus_horizontal | ~(cross_vertical | plus_horizontal)) & full
+        minus_vertical = plus_horizontal & cross_vertical
+    return distance <= limit
+
+
+class CompiledGroup(NamedTuple):
+    """A shared "choose TWO/THREE" group with its options pre-normalized."""
+
+    members: Tuple[int, ...]  # Question numbers (1-based) that receive a verdict
+    size: int  # Questions counted as evaluated (the group as written in the key)
+    option_masks: Optional[Dict[str, int]]  # Normalized answer -> bitmask of options accepting it; None if unkeyed
+
+
+class CompiledKey(NamedTuple):
+    """Immutable answer key with every option normalized once up front.
+
+    Grading a sheet against it is a set/dict lookup per question; no key text
+    is re-normalized. Group verdicts are identical to match_shared_group on
+    the raw key. Single questions also accept the canonical spelling of the
+    key (numbers, dates, times, currency, British/American spelling), so they
+    accept more than is_answer_correct does.
+    """
+
+    keys: Tuple[str, ...]  # Raw key text per question, as compiled
+    singles: Tuple[Tuple[int, FrozenSet[str]], ...]  # (question, accepted normalized forms)
+    groups: Tuple[CompiledGroup, ...]
+    near_forms: Dict[int, Tuple[NearForm, ...]]  # Question -> spellings a near miss is measured against
+
+    def near_miss(self, qnum: int, user_answer: str) -> bool:
+        """Whether a wrong answer to single question qnum is a close misspelling of the key.
+
+        Only meant for answers grade() marked wrong; it does not count as
+        correct. Numbers, letters and short keys never give a near miss.
+        """
+        forms = self.near_forms.get(qnum)
+        if not forms:
+            return False
+        user_normalized = normalize_answer(user_answer)
+        if not user_normalized:
+            return False
+        return any(_within_distance(form, user_normalized) for form in forms)
+
+    def grade(self, answers: Sequence[str]) -> Tuple[List[Optional[bool]], int, int]:
+        """Grade answers (index 0 = question 1).
+
+        Returns (verdicts, correct, evaluated); a verdict is None for questions
+        without a key.
+        """
+        verdicts: List[Optional[bool]] = [None] * len(self.keys)
+        correct = 0
+        evaluated = 0
+        answer_count = len(answers)
+
+        for qnum, accepted in self.singles:
+            user_answer = answers[qnum - 1] if qnum <= answer_count else ""
+            is_correct = _is_accepted(user_answer, accepted)
+            verdicts[qnum - 1] = is_correct
+            evaluated += 1
+            if is_correct:
+                correct += 1
+
+        for group in self.groups:
+            group_verdicts, group_correct = _grade_group(group, answers)
+            for qnum, verdict in zip(group.members, group_verdicts):
+                verdicts[qnum - 1] = verdict
+            correct += group_correct
+            if group.option_masks is not None:
+                evaluated += group.size
+
+        return verdicts, correct, evaluated
+
+    # Incremental grading: a "unit" is one single question or one shared group,
+    # numbered singles first, in the order grade() applies them.
+
+    def unit_count(self) -> int:
+        return len(self.singles) + len(self.groups)
+
+    def unit_members(self, unit: int) -> Tuple[int, ...]:
+        """Question numbers whose verdict the unit sets."""
+        if unit < len(self.singles):
+            return (self.singles[unit][0],)
+        return self.groups[unit - len(self.singles)].members
+
+    def units_by_question(self) -> Dict[int, List[int]]:
+        """Question number -> units that grade it, in grading order."""
+        units: Dict[int, List[int]] = {}
+        for unit in range(self.unit_count()):
+            for qnum in self.unit_members(unit):
+                units.setdefault(qnum, []).append(unit)
+        return units
+
+    def grade_unit(self, unit: int, answers: Sequence[str]) -> Tuple[List[Optional[bool]], int, int]:
+        """Grade one unit; returns (verdicts for unit_members(unit), correct, evaluated).
+
+        Summing units and letting the last unit covering a question set its
+        verdict gives exactly what grade() returns.
+        """
+        answer_count = len(answers)
+        if unit < len(self.singles):
+            qnum, accepted = self.singles[unit]
+            is_correct = _is_accepted(answers[qnum - 1] if qnum <= answer_count else "", accepted)
+            return [is_correct], int(is_correct), 1
+        group = self.groups[unit - len(self.singles)]
+        group_verdicts, group_correct = _grade_group(group, answers)
+        return group_verdicts, group_correct, (group.size if group.option_masks is not None else 0)
+
+
+def _grade_group(group: CompiledGroup, answers: Sequence[str]) -> Tuple[List[Optional[bool]], int]:
+    """Verdicts for a group's members (all None if it has no key) and its correct count."""
+    if group.option_masks is None:
+        return [None] * len(group.members), 0
+    answer_count = len(answers)
+    option_masks = group.option_masks
+    verdicts = _match_options([
+        option_masks.get(normalize_answer(answers[qnum - 1] if qnum <= answer_count else ""), 0)
+        for qnum in group.members
+    ])
+    return verdicts, sum(verdicts)
+
+
+def _key_variants(alternative: str) -> List[str]:
+    """Every spelling one key alternative allows, each "(...)" part either used or left out.
+
+    "(the) library" gives "the library" and "library"; "(a/the) park" gives
+    "park", "a park" and "the park". Leaving out every part is not allowed
+    when nothing else is left.
+    """
+    parts = KEY_OPTIONAL_RE.split(alternative)  # Fixed text at even indexes, optional parts at odd
+    choices = [[""] + [choice.strip() for choice in optional.split("/")] for optional in parts[1::2]]
+    combinations = 1
+    for options in choices:
+        combinations *= len(options)
+    if not choices or combinations > MAX_KEY_VARIANTS:
+        return [alternative]
+    variants = []
+    for picked in itertools.product(*choices):
+        pieces = [parts[0]]
+        for optional, fixed in zip(picked, parts[2::2]):
+            pieces.extend((" ", optional, " ", fixed))
+        variant = " ".join("".join(pieces).split())
+        if variant:
+            variants.append(variant)
+    return variants
+
+
+def _word_count(text: str, numbers_free: bool) -> int:
+    """Words in text; with numbers_free, tokens holding a digit are not counted."""
+    return sum(1 for word in text.split() if not (numbers_free and any(ch.isdigit() for ch in word)))
+
+
+def _accepted_forms(key_raw: str, limit: Optional[WordLimit] = None) -> FrozenSet[str]:
+    """Normalized answers a single-question key accepts, per the key grammar above.
+
+    limit is the instruction's word limit; a "[N words]" typed into the key replaces it.
+    """
+    limit_match = KEY_WORD_LIMIT_RE.search(key_raw)
+    if limit_match:
+        limit = WordLimit(int(limit_match.group(1)), bool(limit_match.group(2)))
+        key_raw = key_raw[:limit_match.start()]
+    word_limit, numbers_free = limit if limit is not None else (None, False)
+
+    accepted = set()
+    for alternative in KEY_ALTERNATIVE_SPLIT_RE.split(key_raw):
+        variants = _key_variants(alternative.strip())
+        if word_limit is not None:
+            # A key that breaks its own limit is kept rather than made unanswerable
+            variants = [v for v in variants if _word_count(v, numbers_free) <= word_limit] or variants
+        for variant in variants:
+            canonical = canonicalize_answer(variant)
+            accepted.add(normalize_answer(variant))
+            accepted.add(normalize_answer(canonical))
+            accepted.update(normalize_answer(spelling) for spelling in key_spellings(canonical))
+    return frozenset(accepted)
+
+
+def _is_accepted(user_answer: str, accepted: FrozenSet[str]) -> bool:
+    """Whether a single-question answer is in the compiled key's accepted forms.
+
+    The canonical spelling ("fifteen" -> "15", "colour" -> "color") is only
+    worked out when the answer as typed is not accepted.
+    """
+    return (normalize_answer(user_answer) in accepted
+            or normalize_answer(canonicalize_answer(user_answer)) in accepted)
+
+
+def compile_answer_key(answer_keys: Sequence[str], shared_groups: Optional[Dict[int, List[int]]] = None,
+                       word_limits: Optional[Dict[int, WordLimit]] = None) -> CompiledKey:
+    """Compile per-question key text (index 0 = question 1) into a CompiledKey.
+
+    Blank keys are skipped and questions in shared_groups are graded as a
+    group against the first non-empty key of that group. Other keys follow
+    the key grammar: "/" separates alternatives, "(the) library" accepts the
+    answer with or without "the", and a trailing "[2 words]" (or the
+    question's entry in word_limits) drops spellings longer than that. Each spelling is accepted as written and in its
+    canonical form (see ielts_canonical), so "15th May" also accepts "May 15".
+    """
+    keys = tuple(key.strip() for key in answer_keys)
+    shared_groups = shared_groups or {}
+    word_limits = word_limits or {}
+    question_total = len(keys)
+
+    singles: List[Tuple[int, FrozenSet[str]]] = []
+    near_forms: Dict[int, Tuple[NearForm, ...]] = {}
+    for qnum, key_raw in enumerate(keys, start=1):
+        if qnum in shared_groups or not key_raw:
+            continue
+        accepted = _accepted_forms(key_raw, word_limits.get(qnum))
+        singles.append((qnum, accepted))
+        forms = tuple(_near_form(form) for form in sorted(accepted)
+                      if len(form) >= NEAR_MISS_MIN_LENGTH and not any(ch.isdecimal() for ch in form))
+        if forms:
+            near_forms[qnum] = forms
+
+    groups: List[CompiledGroup] = []
+    processed_groups = set()
+    for group_questions in shared_groups.values():
+        group_tuple = tuple(sorted(group_questions))
+        if group_tuple in processed_groups:
+            continue
+        processed_groups.add(group_tuple)
+
+        members = tuple(q for q in group_questions if 1 <= q <= question_total)
+        key_answer_str = next((keys[q - 1] for q in members if keys[q - 1]), "")
+        if not key_answer_str:
+            # Kept so that an unkeyed group still clears verdicts in order
+            groups.append(CompiledGroup(members, 0, None))
+            continue
+
+        groups.append(CompiledGroup(members, len(group_questions), _option_masks(key_answer_str, normalize_answer)))
+
+    return CompiledKey(keys, tuple(singles), tuple(groups), near_forms)
+
+
+def compile_answer_text(text: str, question_total: int = NUM_QUESTIONS) -> CompiledKey:
+    """Parse pasted answer text and compile it in one step."""
+    mapping, shared_groups, word_limits = parse_answer_text(text, question_total)
+    answer_keys = [mapping.get(qnum, "") for qnum in range(1, question_total + 1)]
+    return compile_answer_key(answer_keys, shared_groups, word_limits)
@@ -0,0 +1,248 @@
+#!/usr/bin/env python3
+"""Plain-data model of one answer section (no tkinter dependency).
+
+SectionModel holds the answers, answer keys, shared groups, word limits and verdicts of a
+form. The Tkinter SectionFrame mirrors it into its entries and status labels
+through change listeners; grading, saving and loading only touch the lists
+here, so they can run (and be tested) without a display.
+"""
+
+from contextlib import contextmanager
+from typing import Callable, Dict, Iterator, List, Optional, Tuple
+
+from ielts_grading import CompiledKey, WordLimit, compile_answer_key
+
+# Listener fields: a user answer, an answer key, or a verdict changed, or
+# (live grading only, index -1) the running score changed
+FIELD_ANSWER = "u"
+FIELD_KEY = "k"
+FIELD_VERDICT = "v"
+FIELD_SCORE = "s"
+
+ChangeListener = Callable[[str, int], None]
+
+
+class SectionModel:
+    """Answers, keys, shared groups and verdicts for one section (index 0 = question 1).
+
+    Values are kept as entered; answers() and keys() return them stripped.
+    Listeners are called as listener(field, index) after a value really changed.
+
+    With live grading on, every answer edit re-grades only the question's
+    unit (the question, or the shared group it belongs to) and keeps the
+    verdicts and score up to date; a key change re-grades everything.
+    """
+
+    def __init__(self, question_total: int = 0):
+        self._answers: List[str] = [""] * question_total
+        self._keys: List[str] = [""] * question_total
+        self.verdicts: List[Optional[bool]] = [None] * question_total
+        self.near_misses: List[bool] = [False] * question_total  # Wrong, but a close misspelling of the key
+        self.shared_groups: Dict[int, List[int]] = {}  # Maps question number to list of questions in same group
+        self.word_limits: Dict[int, WordLimit] = {}  # Question number -> word limit from the key's instructions
+        self._compiled: Optional[CompiledKey] = None  # Cache for evaluate(), keyed by the stripped keys
+        self.listeners: List[ChangeListener] = []
+        self.live_grading = False
+        self.score: Optional[Tuple[int, int]] = None  # (correct, evaluated) while live grading
+        self._unit_results: List[Tuple[List[Optional[bool]], int, int]] = []  # Per unit of the compiled key
+        self._units_of: Dict[int, List[int]] = {}  # Question number -> units, for the compiled key
+        self._bulk_depth = 0  # Inside a bulk change, live grading waits until the end
+
+    def _notify(self, field: str, index: int) -> None:
+        for listener in self.listeners:
+            listener(field, index)
+
+    def question_count(self) -> int:
+        return len(self._answers)
+
+    def resize(self, question_total: int) -> None:
+        """Start over with question_total blank questions and live grading off (listeners are not called)."""
+        self.live_grading = False  # Its unit indexes belong to the old key
+        self._answers = [""] * question_total
+        self._keys = [""] * question_total
+        self.verdicts = [None] * question_total
+        self.near_misses = [False] * question_total
+        self.shared_groups = {}
+        self.word_limits = {}
+        self._compiled = None
+        self._unit_results = []
+        self._units_of = {}
+        self.score = None
+
+    def answer(self, index: int) -> str:
+        return self._answers[index]
+
+    def key(self, index: int) -> str:
+        return self._keys[index]
+
+    def answers(self) -> List[str]:
+        return [answer.strip() for answer in self._answers]
+
+    def keys(self) -> List[str]:
+        return [key.strip() for key in self._keys]
+
+    def set_answer(self, index: int, value: str) -> bool:
+        """Store a user answer. Returns False if it was unchanged."""
+        if self._answers[index] == value:
+            return False
+        self._answers[index] = value
+        self._notify(FIELD_ANSWER, index)
+        if self.live_grading and not self._bulk_depth:
+            self._regrade_question(index + 1)
+        return True
+
+    def set_key(self, index: int, value: str) -> bool:
+        """Store an answer key. Returns False if it was unchanged."""
+        if self._keys[index] == value:
+            return False
+        self._keys[index] = value
+        self._notify(FIELD_KEY, index)
+        if self.live_grading and not self._bulk_depth:
+            self.evaluate()
+        return True
+
+    def set_verdict(self, index: int, verdict: Optional[bool], near_miss: bool = False) -> None:
+        if self.verdicts[index] is verdict and self.near_misses[index] == near_miss:
+            return
+        self.verdicts[index] = verdict
+        self.near_misses[index] = near_miss
+        self._notify(FIELD_VERDICT, index)
+
+    def _show_verdict(self, index: int, verdict: Optional[bool]) -> None:
+        """set_verdict, flagging wrong answers that are close misspellings of the key."""
+        near_miss = verdict is False and self._compiled.near_miss(index + 1, self._answers[index])
+        self.set_verdict(index, verdict, near_miss)
+
+    @contextmanager
+    def bulk_change(self) -> Iterator[None]:
+        """Group many set_answer/set_key calls; live grading re-grades once at the end."""
+        self._bulk_depth += 1
+        try:
+            yield
+        finally:
+            self._bulk_depth -= 1
+            if self.live_grading and not self._bulk_depth:
+                self.evaluate()
+
+    def apply_answer_keys(self, mapping: Dict[int, str], shared_groups: Optional[Dict[int, List[int]]] = None,
+                          word_limits: Optional[Dict[int, WordLimit]] = None) -> None:
+        """Apply parse_answer_text output; questions missing from mapping keep their key."""
+        with self.bulk_change():
+            self.shared_groups = dict(shared_groups) if shared_groups else {}
+            self.word_limits = dict(word_limits) if word_limits else {}
+            for qnum, value in mapping.items():
+                if value and 1 <= qnum <= len(self._keys):
+                    self.set_key(qnum - 1, value)
+            self._compiled = None
+
+    def clear_answers(self) -> None:
+        with self.bulk_change():
+            for index in range(len(self._answers)):
+                self.set_answer(index, "")
+
+    def clear_keys(self) -> None:
+        with self.bulk_change():
+            for index in range(len(self._keys)):
+                self.set_key(index, "")
+
+    def clear_verdicts(self) -> None:
+        for index in range(len(self.verdicts)):
+            self.set_verdict(index, None)
+
+    def reset(self) -> None:
+        """Blank answers, keys, verdicts and shared groups, and turn live grading off."""
+        self.set_live_grading(False)
+        self.clear_answers()
+        self.clear_keys()
+        self.clear_verdicts()
+        self.shared_groups = {}
+        self.word_limits = {}
+        self._compiled = None
+
+    def compiled_answer_key(self) -> CompiledKey:
+        """Return the compiled key for the current keys, recompiling only if they changed."""
+        keys = tuple(self.keys())
+        if self._compiled is None or self._compiled.keys != keys:
+            self._compiled = compile_answer_key(keys, self.shared_groups, self.word_limits)
+        return self._compiled
+
+    def evaluate(self) -> Tuple[int, int]:
+        """Grade the answers, store per-question verdicts, and return (correct, evaluated)."""
+        key = self.compiled_answer_key()
+        if self.live_grading:
+            # Grade unit by unit so later edits can re-grade just their unit
+            self._units_of = key.units_by_question()
+            self._unit_results = [key.grade_unit(unit, self._answers) for unit in range(key.unit_count())]
+            for index in range(len(self.verdicts)):
+                self._show_verdict(index, self._live_verdict(index + 1))
+            return self._update_score()
+        verdicts, correct, evaluated = key.grade(self.answers())
+        for index, verdict in enumerate(verdicts):
+            self._show_verdict(index, verdict)
+        return correct, evaluated
+
+    def set_live_grading(self, enabled: bool) -> None:
+        """Turn live grading on (grading everything once) or off (verdicts are kept)."""
+        if enabled == self.live_grading:
+            return
+        self.live_grading = enabled
+        if enabled:
+            self.evaluate()
+        else:
+            self._unit_results = []
+            self._units_of = {}
+            self.score = None
+
+    def _live_verdict(self, qnum: int) -> Optional[bool]:
+        """The verdict grade() would give: the one from the last unit covering the question."""
+        units = self._units_of.get(qnum)
+        if not units:
+            return None
+        unit = units[-1]
+        members = self._compiled.unit_members(unit)
+        return self._unit_results[unit][0][members.index(qnum)]
+
+    def _regrade_question(self, qnum: int) -> None:
+        units = self._units_of.get(qnum)
+        if not units:
+            return  # No key for this question
+        touched = set()
+        for unit in units:
+            self._unit_results[unit] = self._compiled.grade_unit(unit, self._answers)
+            touched.update(self._compiled.unit_members(unit))
+        for member in touched:
+            self._show_verdict(member - 1, self._live_verdict(member))
+        self._update_score()
+
+    def _update_score(self) -> Tuple[int, int]:
+        score = (sum(result[1] for result in self._unit_results),
+                 sum(result[2] for result in self._unit_results))
+        if score != self.score:
+            self.score = score
+            self._notify(FIELD_SCORE, -1)
+        return score
+
+    def to_state(self) -> Dict:
+        """Answers, keys, shared groups and word limits in the saved form-state format."""
+        state: Dict = {
+            "user_answers": self.answers(),
+            "answer_keys": self.keys(),
+        }
+        if self.shared_groups:
+            state["shared_groups"] = {str(qnum): group for qnum, group in self.shared_groups.items()}
+        if self.word_limits:
+            state["word_limits"] = {str(qnum): list(limit) for qnum, limit in self.word_limits.items()}
+        return state
+
+    def load_state(self, state: Dict) -> None:
+        """Restore what to_state() saved; missing entries are left as they are."""
+        with self.bulk_change():
+            for index, value in enumerate(state.get("user_answers", [])[:len(self._answers)]):
+                self.set_answer(index, value)
+            for index, value in enumerate(state.get("answer_keys", [])[:len(self._keys)]):
+                if value:
+                    self.set_key(index, value)
+            # JSON object keys are strings; question numbers are ints everywhere else
+            self.shared_groups = {int(qnum): list(group) for qnum, group in state.get("shared_groups", {}).items()}
+            self.word_limits = {int(qnum): WordLimit(*limit) for qnum, limit in state.get("word_limits", {}).items()}
+            self._compiled = None
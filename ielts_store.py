@@ -0,0 +1,900 @@
+#!/usr/bin/env python3
+"""SQLite persistence for form lists and per-form state (no tkinter dependency).
+
+Each form state is its own row keyed by "section:form_name", so saving one
+form touches one row instead of rewriting the whole database. The legacy
+forms.json file is imported once on first open.
+
+Answer key lists are stored once per distinct content in answer_key_sets,
+addressed by their SHA-256 (key_hash); a form state row keeps only that
+hash, in its state JSON and in an indexed key_hash column, so finding every
+form that used a key is one index lookup. Callers always see whole states.
+
+Every submitted attempt at a form is kept in the attempts table. Most rows
+hold only what changed since the form's previous attempt (see diff_state);
+every ATTEMPT_SNAPSHOT_EVERY-th attempt is stored whole, so rebuilding any
+attempt reads at most that many rows.
+
+KeyLibrary keeps official answer keys imported from a folder of key files,
+indexed by (Cambridge book, section, test), so a form can pick up its key
+without the text being parsed again.
+
+StoreWriter saves form states and lists on a background thread, so the UI
+never waits for SQLite.
+
+EditJournal is a small append-only log of individual entry edits written
+between saves, so a crash loses at most the debounce window.
+"""
+
+import hashlib
+import json
+import os
+import re
+import sqlite3
+import sys
+import threading
+from pathlib import Path
+from typing import Callable, Dict, List, NamedTuple, Optional, Sequence, Set, Tuple
+
+from ielts_grading import KEY_WORD_LIMIT_RE, WordLimit, iter_answer_tests
+
+# Get user data directory based on platform
+def get_user_data_dir() -> Path:
+    """Get platform-specific user data directory for storing application data.
+    
+    Linux: ~/.local/share/ielts-form/
+    Windows: %APPDATA%/IELTSForm/
+    macOS: ~/Library/Application Support/IELTSForm/
+    """
+    if sys.platform == "win32":
+        # Windows: Use APPDATA (roaming) or LOCALAPPDATA (local)
+        appdata = os.getenv("APPDATA")
+        if appdata:
+            return Path(appdata) / "IELTSForm"
+        # Fallback to user home
+        return Path.home() / "AppData" / "Roaming" / "IELTSForm"
+    elif sys.platform == "darwin":
+        # macOS: Use Application Support
+        return Path.home() / "Library" / "Application Support" / "IELTSForm"
+    else:
+        # Linux and other Unix-like: Use XDG Base Directory Specification
+        # Prefer XDG_DATA_HOME, fallback to ~/.local/share
+        xdg_data_home = os.getenv("XDG_DATA_HOME")
+        if xdg_data_home:
+            return Path(xdg_data_home) / "ielts-form"
+        return Path.home() / ".local" / "share" / "ielts-form"
+
+# Database files in the user data directory
+USER_DATA_DIR = get_user_data_dir()
+FORMS_DB_FILE = USER_DATA_DIR / "forms.json"  # Legacy JSON database, migrated into FORMS_SQLITE_FILE
+FORMS_SQLITE_FILE = USER_DATA_DIR / "forms.sqlite3"
+FORMS_JOURNAL_FILE = USER_DATA_DIR / "forms.journal"  # Edits since the last save, replayed after a crash
+
+SCHEMA_VERSION = 3  # 2: answer keys interned in answer_key_sets; 3: answer_keys.word_limits
+
+SCHEMA = """
+CREATE TABLE IF NOT EXISTS meta (
+    key   TEXT PRIMARY KEY,
+    value TEXT NOT NULL
+);
+CREATE TABLE IF NOT EXISTS forms (
+    section  TEXT NOT NULL,
+    name     TEXT NOT NULL,
+    position INTEGER NOT NULL,
+    PRIMARY KEY (section, name)
+);
+CREATE INDEX IF NOT EXISTS forms_by_position ON forms (section, position);
+CREATE TABLE IF NOT EXISTS form_states (
+    form_key TEXT PRIMARY KEY,
+    state    TEXT NOT NULL,
+    key_hash TEXT
+);
+CREATE TABLE IF NOT EXISTS answer_key_sets (
+    key_hash    TEXT PRIMARY KEY,
+    answer_keys TEXT NOT NULL
+);
+CREATE TABLE IF NOT EXISTS attempts (
+    form_key     TEXT NOT NULL,
+    number       INTEGER NOT NULL,
+    submitted_at TEXT NOT NULL,
+    correct      INTEGER NOT NULL,
+    evaluated    INTEGER NOT NULL,
+    full         INTEGER NOT NULL,
+    payload      TEXT NOT NULL,
+    PRIMARY KEY (form_key, number)
+);
+CREATE TABLE IF NOT EXISTS answer_keys (
+    cam           INTEGER NOT NULL,
+    section       TEXT NOT NULL,
+    test          INTEGER NOT NULL,
+    mapping       TEXT NOT NULL,
+    shared_groups TEXT NOT NULL,
+    source        TEXT NOT NULL,
+    word_limits   TEXT NOT NULL DEFAULT '{}',
+    PRIMARY KEY (cam, section, test)
+);
+"""
+
+# Stored form states name their answer key list by hash under this field instead of "answer_keys"
+KEY_REF_FIELD = "answer_keys_ref"
+
+ATTEMPT_SNAPSHOT_EVERY = 10  # Attempts 1, 11, 21, ... are stored whole; the rest as deltas
+
+WRITE_RETRY_SECONDS = 2.0  # StoreWriter retries a failed write this often until it succeeds
+
+
+def _keys_json(answer_keys: Sequence[str]) -> str:
+    return json.dumps(list(answer_keys), ensure_ascii=False, separators=(",", ":"))
+
+
+def key_hash(answer_keys: Sequence[str]) -> str:
+    """Content address of an answer key list, as stored in answer_key_sets."""
+    return hashlib.sha256(_keys_json(answer_keys).encode("utf-8")).hexdigest()
+
+
+class StoredState(NamedTuple):
+    """A form state as written to form_states, with its answer keys split out."""
+    payload: str  # State JSON, with KEY_REF_FIELD in place of "answer_keys"
+    key_hash: Optional[str]  # None if the state has no answer key list
+    keys_json: Optional[str]
+
+
+def stored_state(state: Dict) -> StoredState:
+    answer_keys = state.get("answer_keys")
+    if not isinstance(answer_keys, list):
+        return StoredState(json.dumps(state, ensure_ascii=False), None, None)
+    keys_json = _keys_json(answer_keys)
+    digest = hashlib.sha256(keys_json.encode("utf-8")).hexdigest()
+    stored = {field: value for field, value in state.items() if field != "answer_keys"}
+    stored[KEY_REF_FIELD] = digest
+    return StoredState(json.dumps(stored, ensure_ascii=False), digest, keys_json)
+
+
+class Attempt(NamedTuple):
+    """One submitted attempt at a form: its score and the whole form state at that moment."""
+    form_key: str
+    submitted_at: str  # ISO 8601, local time
+    correct: int
+    evaluated: int
+    state: Dict
+
+
+def diff_state(old: Dict, new: Dict) -> Dict:
+    """Delta that turns form state old into new (see apply_delta).
+
+    List fields (answers, keys) store only the changed slots and the new
+    length; other fields are replaced whole or dropped.
+    """
+    delta: Dict = {}
+    for field, value in new.items():
+        previous = old.get(field)
+        if value == previous:
+            continue
+        if isinstance(value, list) and isinstance(previous, list):
+            changes = [[index, item] for index, item in enumerate(value)
+                       if index >= len(previous) or previous[index] != item]
+            delta.setdefault("lists", {})[field] = {"length": len(value), "changes": changes}
+        else:
+            delta.setdefault("set", {})[field] = value
+    dropped = [field for field in old if field not in new]
+    if dropped:
+        delta["drop"] = dropped
+    return delta
+
+
+def apply_delta(old: Dict, delta: Dict) -> Dict:
+    """Return the state diff_state(old, new) was made from; old is not modified."""
+    state = dict(old)
+    for field in delta.get("drop", []):
+        state.pop(field, None)
+    state.update(delta.get("set", {}))
+    for field, change in delta.get("lists", {}).items():
+        values = list(old.get(field, []))[:change["length"]]
+        values.extend([None] * (change["length"] - len(values)))  # Every new slot is in changes
+        for index, item in change["changes"]:
+            values[index] = item
+        state[field] = values
+    return state
+
+
+# "Practice Cam 10 Listening Test 01", "cam10_reading_test2.txt", "Cambridge 9 - Listening - Test 3"
+KEY_ID_RE = re.compile(r"cam(?:bridge)?\s*[_\-]?\s*(\d+)\D*?(listening|reading)\D*?test\s*[_\-]?\s*(\d+)", re.IGNORECASE)
+
+KeyId = Tuple[int, str, int]  # (cam, section, test); section is "listening" or "reading"
+
+
+def parse_key_id(text: str) -> Optional[KeyId]:
+    """Find the (cam, section, test) a form name or key file name refers to."""
+    match = KEY_ID_RE.search(text)
+    if not match:
+        return None
+    return int(match.group(1)), match.group(2).lower(), int(match.group(3))
+
+
+class FormStore:
+    """Form lists and form states stored as rows in an SQLite (WAL) database."""
+
+    def __init__(self, db_path: Path, legacy_json: Optional[Path] = None):
+        self.db_path = Path(db_path)
+        self.conn = sqlite3.connect(str(self.db_path))
+        self.conn.execute("PRAGMA journal_mode=WAL")
+        self.conn.execute("PRAGMA synchronous=NORMAL")
+        with self.conn:
+            self.conn.executescript(SCHEMA)
+            self.conn.execute(
+                "INSERT OR IGNORE INTO meta (key, value) VALUES ('schema_version', ?)", (str(SCHEMA_VERSION),)
+            )
+        self._upgrade_schema()
+        self.conn.execute("CREATE INDEX IF NOT EXISTS form_states_by_key_hash ON form_states (key_hash)")
+        # Last payload written per form key / last list written per section,
+        # so unchanged data is never rewritten.
+        self._written_states: Dict[str, str] = {}
+        self._key_sets: Dict[str, Tuple[str, ...]] = {}  # Parsed answer_key_sets rows by hash
+        self._written_forms: Dict[str, Tuple[str, ...]] = {}
+        self._latest_attempts: Dict[str, Tuple[int, Dict]] = {}  # Form key -> (number, state) of its last attempt
+        self.key_library = KeyLibrary(self.conn)
+        if legacy_json is not None:
+            self.migrate_from_json(Path(legacy_json))
+
+    def _get_meta(self, key: str) -> Optional[str]:
+        row = self.conn.execute("SELECT value FROM meta WHERE key = ?", (key,)).fetchone()
+        return row[0] if row else None
+
+    def _upgrade_schema(self) -> None:
+        """Bring a database written by an older version up to SCHEMA_VERSION."""
+        version = int(self._get_meta("schema_version") or SCHEMA_VERSION)
+        if version >= SCHEMA_VERSION:
+            return
+        with self.conn:
+            if version < 2:
+                columns = {row[1] for row in self.conn.execute("PRAGMA table_info(form_states)")}
+                if "key_hash" not in columns:
+                    self.conn.execute("ALTER TABLE form_states ADD COLUMN key_hash TEXT")
+                # Intern the answer keys of every existing state
+                rows = {}
+                for form_key, payload in self.conn.execute("SELECT form_key, state FROM form_states").fetchall():
+                    try:
+                        rows[form_key] = stored_state(json.loads(payload))
+                    except json.JSONDecodeError:
+                        continue  # load_states reports it
+                self._write_states(rows)
+            if version < 3:
+                columns = {row[1] for row in self.conn.execute("PRAGMA table_info(answer_keys)")}
+                if "word_limits" not in columns:
+                    self.conn.execute("ALTER TABLE answer_keys ADD COLUMN word_limits TEXT NOT NULL DEFAULT '{}'")
+                # Older imports appended the instruction's limit to the key text as " [2 words]"
+                updates = []
+                for cam, section, test, mapping_json in self.conn.execute(
+                        "SELECT cam, section, test, mapping FROM answer_keys").fetchall():
+                    mapping, word_limits = json.loads(mapping_json), {}
+                    for qnum, answer in mapping.items():
+                        match = KEY_WORD_LIMIT_RE.search(answer)
+                        if match:
+                            mapping[qnum] = answer[:match.start()]
+                            word_limits[qnum] = [int(match.group(1)), bool(match.group(2))]
+                    if word_limits:
+                        updates.append((json.dumps(mapping, ensure_ascii=False), json.dumps(word_limits),
+                                        cam, section, test))
+                self.conn.executemany(
+                    "UPDATE answer_keys SET mapping = ?, word_limits = ? WHERE cam = ? AND section = ? AND test = ?",
+                    updates,
+                )
+            self.conn.execute("UPDATE meta SET value = ? WHERE key = 'schema_version'", (str(SCHEMA_VERSION),))
+
+    def _write_states(self, rows: Dict[str, StoredState]) -> None:
+        """Insert or replace state rows (and their key lists) inside the caller's transaction."""
+        key_sets = {stored.key_hash: stored.keys_json for stored in rows.values() if stored.key_hash is not None}
+        self.conn.executemany(
+            "INSERT OR IGNORE INTO answer_key_sets (key_hash, answer_keys) VALUES (?, ?)", key_sets.items()
+        )
+        self.conn.executemany(
+            "INSERT OR REPLACE INTO form_states (form_key, state, key_hash) VALUES (?, ?, ?)",
+            [(form_key, stored.payload, stored.key_hash) for form_key, stored in rows.items()],
+        )
+
+    def _key_hashes_of(self, form_keys: Sequence[str]) -> Set[str]:
+        """Key list hashes the stored states of these forms use."""
+        hashes: Set[str] = set()
+        for start in range(0, len(form_keys), 500):  # Stay under SQLite's bound-parameter limit
+            chunk = form_keys[start:start + 500]
+            rows = self.conn.execute(
+                f"SELECT DISTINCT key_hash FROM form_states WHERE key_hash IS NOT NULL "
+                f"AND form_key IN ({','.join('?' * len(chunk))})",
+                chunk,
+            )
+            hashes.update(row[0] for row in rows)
+        return hashes
+
+    def _answer_keys(self, digest: str) -> Tuple[str, ...]:
+        answer_keys = self._key_sets.get(digest)
+        if answer_keys is None:
+            row = self.conn.execute(
+                "SELECT answer_keys FROM answer_key_sets WHERE key_hash = ?", (digest,)
+            ).fetchone()
+            answer_keys = tuple(json.loads(row[0])) if row else ()
+            self._key_sets[digest] = answer_keys
+        return answer_keys
+
+    def _load_state(self, payload: str) -> Dict:
+        """Parse a stored state and put its answer key list back (a list of its own, safe to modify)."""
+        state = json.loads(payload)
+        digest = state.pop(KEY_REF_FIELD, None)
+        if digest is not None:
+            state["answer_keys"] = list(self._answer_keys(digest))
+        return state
+
+    def migrate_from_json(self, json_path: Path) -> bool:
+        """Import a forms.json database once. Returns True if data was imported."""
+        if self._get_meta("migrated_from_json") or not json_path.exists():
+            return False
+        with open(json_path, "r", encoding="utf-8") as f:
+            data = json.load(f)
+        with self.conn:
+            for section in ("listening", "reading"):
+                forms = data.get(f"{section}_forms", [])
+                self.conn.executemany(
+                    "INSERT OR IGNORE INTO forms (section, name, position) VALUES (?, ?, ?)",
+                    [(section, name, position) for position, name in enumerate(forms)],
+                )
+            self._write_states({key: stored_state(state) for key, state in data.get("form_states", {}).items()})
+            self.conn.execute(
+                "INSERT OR REPLACE INTO meta (key, value) VALUES ('migrated_from_json', ?)", (str(json_path),)
+            )
+        return True
+
+    def load_forms(self, section: str) -> List[str]:
+        rows = self.conn.execute(
+            "SELECT name FROM forms WHERE section = ? ORDER BY position", (section,)
+        ).fetchall()
+        names = [row[0] for row in rows]
+        self._written_forms[section] = tuple(names)
+        return names
+
+    def load_states(self) -> Dict[str, Dict]:
+        states: Dict[str, Dict] = {}
+        # Few distinct key lists are shared by many forms: read them all once
+        for digest, keys_json in self.conn.execute("SELECT key_hash, answer_keys FROM answer_key_sets"):
+            self._key_sets[digest] = tuple(json.loads(keys_json))
+        for form_key, payload in self.conn.execute("SELECT form_key, state FROM form_states"):
+            try:
+                states[form_key] = self._load_state(payload)
+            except json.JSONDecodeError as e:
+                print(f"Warning: Skipping unreadable state for {form_key}: {e}")
+                continue
+            self._written_states[form_key] = payload
+        return states
+
+    def get_state(self, form_key: str) -> Optional[Dict]:
+        row = self.conn.execute("SELECT state FROM form_states WHERE form_key = ?", (form_key,)).fetchone()
+        return self._load_state(row[0]) if row else None
+
+    def put_state(self, form_key: str, state: Dict) -> bool:
+        """Write one form's state. Returns False if it was already stored unchanged."""
+        return self.apply_changes({form_key: state}, {}) > 0
+
+    def delete_state(self, form_key: str) -> None:
+        """Delete a form's saved state and its attempt history."""
+        self.apply_changes({form_key: None}, {})
+
+    def forms_with_key(self, answer_keys: Sequence[str]) -> List[str]:
+        """Form keys whose saved state uses exactly this answer key list (an index lookup)."""
+        rows = self.conn.execute(
+            "SELECT form_key FROM form_states WHERE key_hash = ? ORDER BY form_key", (key_hash(answer_keys),)
+        )
+        return [row[0] for row in rows]
+
+    def set_forms(self, section: str, names: List[str]) -> bool:
+        """Store a section's form list in order. Returns False if unchanged."""
+        names_tuple = tuple(names)
+        if self._written_forms.get(section) == names_tuple:
+            return False
+        with self.conn:
+            self.conn.execute("DELETE FROM forms WHERE section = ?", (section,))
+            self.conn.executemany(
+                "INSERT OR IGNORE INTO forms (section, name, position) VALUES (?, ?, ?)",
+                [(section, name, position) for position, name in enumerate(names_tuple)],
+            )
+        self._written_forms[section] = names_tuple
+        return True
+
+    def apply_changes(self, states: Dict[str, Optional[Dict]], forms: Dict[str, Sequence[str]],
+                      attempts: Sequence[Attempt] = ()) -> int:
+        """Write form states (None deletes one, with its attempts), form lists and new attempts in one transaction.
+
+        Rows that are already stored unchanged are skipped, as in put_state and
+        set_forms. Returns the number of states written or deleted.
+        """
+        payloads: Dict[str, Optional[StoredState]] = {}
+        for form_key, state in states.items():
+            if state is None:
+                payloads[form_key] = None
+                continue
+            stored = stored_state(state)
+            if self._written_states.get(form_key) != stored.payload:
+                payloads[form_key] = stored
+        form_lists = {section: tuple(names) for section, names in forms.items()
+                      if self._written_forms.get(section) != tuple(names)}
+        if not payloads and not form_lists and not attempts:
+            return 0
+
+        deleted = [form_key for form_key, stored in payloads.items() if stored is None]
+        with self.conn:
+            # Key lists the rewritten rows used before; dropped below if nothing uses them any more
+            replaced_hashes = self._key_hashes_of(list(payloads))
+            self._write_states({form_key: stored for form_key, stored in payloads.items() if stored is not None})
+            self.conn.executemany("DELETE FROM form_states WHERE form_key = ?", [(form_key,) for form_key in deleted])
+            replaced_hashes -= {stored.key_hash for stored in payloads.values() if stored is not None}
+            for digest in replaced_hashes:
+                self.conn.execute(
+                    "DELETE FROM answer_key_sets WHERE key_hash = ? "
+                    "AND NOT EXISTS (SELECT 1 FROM form_states WHERE key_hash = ?)",
+                    (digest, digest),
+                )
+            self.conn.executemany("DELETE FROM attempts WHERE form_key = ?", [(form_key,) for form_key in deleted])
+            latest: Dict[str, Optional[Tuple[int, Dict]]] = dict.fromkeys(deleted)
+            for attempt in attempts:
+                self._insert_attempt(attempt, latest)
+            for section, names in form_lists.items():
+                self.conn.execute("DELETE FROM forms WHERE section = ?", (section,))
+                self.conn.executemany(
+                    "INSERT OR IGNORE INTO forms (section, name, position) VALUES (?, ?, ?)",
+                    [(section, name, position) for position, name in enumerate(names)],
+                )
+        for form_key, stored in payloads.items():
+            if stored is None:
+                self._written_states.pop(form_key, None)
+            else:
+                self._written_states[form_key] = stored.payload
+        for digest in replaced_hashes:
+            self._key_sets.pop(digest, None)
+        self._written_forms.update(form_lists)
+        self._remember_attempts(latest)
+        return len(payloads)
+
+    def add_attempt(self, attempt: Attempt) -> int:
+        """Store a submitted attempt. Returns its number (1 for a form's first attempt)."""
+        latest: Dict[str, Optional[Tuple[int, Dict]]] = {}
+        with self.conn:
+            number = self._insert_attempt(attempt, latest)
+        self._remember_attempts(latest)
+        return number
+
+    def _remember_attempts(self, latest: Dict[str, Optional[Tuple[int, Dict]]]) -> None:
+        """Cache the last attempts of a committed transaction (None: the form's history was deleted)."""
+        for form_key, last in latest.items():
+            if last is None:
+                self._latest_attempts.pop(form_key, None)
+            else:
+                self._latest_attempts[form_key] = last
+
+    def _insert_attempt(self, attempt: Attempt, batch: Dict[str, Optional[Tuple[int, Dict]]]) -> int:
+        """Insert within the caller's transaction: a delta against the previous attempt, or a full snapshot.
+
+        batch holds the last attempt per form written so far in this transaction
+        (None after a deletion); the cache is only updated once it commits.
+        """
+        if attempt.form_key in batch:
+            latest = batch[attempt.form_key]
+        else:
+            latest = self._latest_attempts.get(attempt.form_key)
+            if latest is None:
+                row = self.conn.execute(
+                    "SELECT MAX(number) FROM attempts WHERE form_key = ?", (attempt.form_key,)
+                ).fetchone()
+                if row[0] is not None:
+                    latest = (row[0], self.get_attempt(attempt.form_key, row[0]))
+        number = latest[0] + 1 if latest else 1
+        full_payload = json.dumps(attempt.state, ensure_ascii=False)
+        full = latest is None or number % ATTEMPT_SNAPSHOT_EVERY == 1
+        payload = full_payload
+        if not full:
+            payload = json.dumps(diff_state(latest[1], attempt.state), ensure_ascii=False)
+            if len(payload) >= len(full_payload):
+                full, payload = True, full_payload
+        self.conn.execute(
+            "INSERT INTO attempts (form_key, number, submitted_at, correct, evaluated, full, payload) "
+            "VALUES (?, ?, ?, ?, ?, ?, ?)",
+            (attempt.form_key, number, attempt.submitted_at, attempt.correct, attempt.evaluated, int(full), payload),
+        )
+        batch[attempt.form_key] = (number, attempt.state)
+        return number
+
+    def list_attempts(self, form_key: str) -> List[Tuple[int, str, int, int]]:
+        """(number, submitted_at, correct, evaluated) of every attempt at a form, oldest first."""
+        return self.conn.execute(
+            "SELECT number, submitted_at, correct, evaluated FROM attempts WHERE form_key = ? ORDER BY number",
+            (form_key,),
+        ).fetchall()
+
+    def get_attempt(self, form_key: str, number: int) -> Optional[Dict]:
+        """Rebuild the form state of one attempt from the nearest full snapshot and the deltas after it."""
+        rows = self.conn.execute(
+            "SELECT number, full, payload FROM attempts WHERE form_key = ? AND number <= ? AND number >= "
+            "(SELECT MAX(number) FROM attempts WHERE form_key = ? AND number <= ? AND full = 1) ORDER BY number",
+            (form_key, number, form_key, number),
+        ).fetchall()
+        if not rows or rows[-1][0] != number:
+            return None
+        state: Dict = {}
+        for _, full, payload in rows:
+            data = json.loads(payload)
+            state = data if full else apply_delta(state, data)
+        return state
+
+    def close(self) -> None:
+        self.conn.close()
+
+
+class StoreWriter:
+    """Background thread that writes snapshots of form states and lists to the database.
+
+    submit() hands over a snapshot and returns at once. Snapshots that arrive
+    while a write is running are merged (the latest state of a form wins), so
+    a burst of saves costs one transaction. Submitted state dicts are owned by
+    the writer from then on and must not be mutated. flush() is the barrier
+    for shutdown: it waits until everything submitted so far was written.
+
+    The thread opens its own FormStore, since an SQLite connection belongs to
+    the thread that created it. A failed write is kept and retried every
+    WRITE_RETRY_SECONDS (merged with anything submitted meanwhile), and once
+    more on close(); its on_written callbacks only run once it succeeds.
+    While it is failing, `failure` holds the error and flush() returns False.
+    If close() times out, take_pending() hands the unwritten changes back so
+    the caller can write them itself.
+    """
+
+    def __init__(self, db_path: Path):
+        self.db_path = Path(db_path)
+        self._changed = threading.Condition()
+        self._states: Dict[str, Optional[Dict]] = {}  # Pending form states; None deletes the row
+        self._forms: Dict[str, Tuple[str, ...]] = {}  # Pending form lists by section
+        self._attempts: List[Attempt] = []  # Pending attempts, in submission order
+        self._callbacks: List[Callable[[], None]] = []  # Run after the pending changes are written
+        self._in_flight: Optional[Tuple] = None  # (states, forms, attempts, callbacks) being written right now
+        self._submitted = 0  # Snapshots handed over so far
+        self._done = 0  # Snapshots the thread has tried to write (see failure for whether it worked)
+        self._failure: Optional[Exception] = None  # Error of the last write; None once one succeeds
+        self._closing = False
+        self._thread = threading.Thread(target=self._run, name="ielts-store-writer", daemon=True)
+        self._thread.start()
+
+    def submit(self, states: Dict[str, Optional[Dict]], forms: Dict[str, Sequence[str]],
+               on_written: Optional[Callable[[], None]] = None, attempts: Sequence[Attempt] = ()) -> None:
+        """Queue form states (None = delete), form lists and attempts; on_written runs on the writer thread.
+
+        Attempts are never merged away: each one becomes its own row.
+        """
+        with self._changed:
+            if self._closing:
+                raise RuntimeError("StoreWriter is closed")
+            for form_key, state in states.items():
+                if state is None:
+                    # A deleted form's history goes with it, including attempts still queued
+                    self._attempts = [attempt for attempt in self._attempts if attempt.form_key != form_key]
+                self._states[form_key] = state
+            self._forms.update((section, tuple(names)) for section, names in forms.items())
+            self._attempts.extend(attempts)
+            if on_written is not None:
+                self._callbacks.append(on_written)
+            self._submitted += 1
+            self._changed.notify_all()
+
+    @property
+    def failure(self) -> Optional[Exception]:
+        """Why the last write failed, while its changes are still waiting to be retried; else None."""
+        with self._changed:
+            return self._failure
+
+    def flush(self, timeout: Optional[float] = None) -> bool:
+        """Wait until every snapshot submitted so far was tried.
+
+        Returns True if it was written; False on timeout or if the write
+        failed (the changes stay queued for retry).
+        """
+        with self._changed:
+            target = self._submitted
+            if not self._changed.wait_for(lambda: self._done >= target, timeout):
+                return False
+            return self._failure is None
+
+    def close(self, timeout: Optional[float] = None) -> bool:
+        """Flush, then stop the thread and close its database connection.
+
+        Returns False if changes could not be written, even on the last retry.
+        """
+        self.flush(timeout)
+        with self._changed:
+            self._closing = True
+            self._changed.notify_all()
+        self._thread.join(timeout)
+        with self._changed:
+            return not self._thread.is_alive() and self._failure is None
+
+    def take_pending(self) -> Tuple[Dict[str, Optional[Dict]], Dict[str, Tuple[str, ...]], List[Attempt],
+                                    List[Callable[[], None]]]:
+        """Stop the writer and return (states, forms, attempts, on_written callbacks) it has not written.
+
+        Includes a write that is still running, so a caller whose close()
+        timed out can apply the changes itself and then run the callbacks.
+        """
+        with self._changed:
+            self._closing = True
+            states, forms, attempts, callbacks = {}, {}, [], []
+            if self._in_flight is not None:
+                states, forms, attempts, callbacks = (dict(self._in_flight[0]), dict(self._in_flight[1]),
+                                                      list(self._in_flight[2]), list(self._in_flight[3]))
+                self._in_flight = None
+            states.update(self._states)
+            forms.update(self._forms)
+            attempts += self._attempts
+            callbacks += self._callbacks
+            self._states, self._forms, self._attempts, self._callbacks = {}, {}, [], []
+            self._done = self._submitted  # Nothing is left for the thread; let it exit
+            self._changed.notify_all()
+            return states, forms, attempts, callbacks
+
+    def _run(self) -> None:
+        store: Optional[FormStore] = None
+        try:
+            while True:
+                with self._changed:
+                    # Wake for new snapshots or to close; while failing, also to retry
+                    retry_after = WRITE_RETRY_SECONDS if self._failure is not None else None
+                    self._changed.wait_for(lambda: self._closing or self._done < self._submitted, retry_after)
+                    last_try = self._closing and self._done >= self._submitted
+                    if last_try and self._failure is None:
+                        return
+                    states, forms, attempts, callbacks = self._states, self._forms, self._attempts, self._callbacks
+                    self._states, self._forms, self._attempts, self._callbacks = {}, {}, [], []
+                    self._in_flight = (states, forms, attempts, callbacks)
+                    target = self._submitted
+                    was_failing = self._failure is not None
+                error: Optional[Exception] = None
+                try:
+                    if store is None:
+                        store = FormStore(self.db_path)
+                    store.apply_changes(states, forms, attempts)
+                except Exception as e:
+                    # Any error is kept for retry; letting it end the thread would leave flush() waiting forever
+                    if not was_failing:
+                        print(f"Warning: Could not save database: {e}")  # Once per failing streak, not per retry
+                    error = e
+                with self._changed:
+                    if self._in_flight is None:
+                        return  # take_pending() took this batch over; the caller writes it
+                    self._in_flight = None
+                    if error is not None:
+                        # Keep the batch under anything submitted meanwhile, for the next attempt
+                        states.update(self._states)
+                        forms.update(self._forms)
+                        self._states, self._forms = states, forms
+                        self._attempts = attempts + self._attempts
+                        self._callbacks = callbacks + self._callbacks
+                if error is None:
+                    for callback in callbacks:
+                        try:
+                            callback()
+                        except Exception as e:
+                            print(f"Warning: Could not finish saving: {e}")
+                with self._changed:
+                    self._failure = error
+                    self._done = max(self._done, target)
+                    self._changed.notify_all()
+                if last_try:
+                    return
+        finally:
+            if store is not None:
+                store.close()
+
+
+class KeyLibrary:
+    """Parsed answer keys stored in the form database, one row per (cam, section, test).
+
+    Keys are parsed once on import and stored as JSON, so attaching a key to a
+    form is a primary-key lookup and a json.loads.
+    """
+
+    def __init__(self, conn: sqlite3.Connection):
+        self.conn = conn
+
+    def put_key(self, key_id: KeyId, mapping: Dict[int, str], shared_groups: Dict[int, List[int]],
+                source: str = "", word_limits: Optional[Dict[int, WordLimit]] = None) -> None:
+        cam, section, test = key_id
+        with self.conn:
+            self.conn.execute(
+                "INSERT OR REPLACE INTO answer_keys (cam, section, test, mapping, shared_groups, source, word_limits) "
+                "VALUES (?, ?, ?, ?, ?, ?, ?)",
+                (cam, section, test, json.dumps(mapping, ensure_ascii=False), json.dumps(shared_groups), source,
+                 json.dumps(word_limits or {})),
+            )
+
+    def get_key(self, key_id: KeyId) -> Optional[Tuple[Dict[int, str], Dict[int, List[int]], Dict[int, WordLimit]]]:
+        """Return (mapping, shared_groups, word_limits) in parse_answer_text's shape, or None."""
+        row = self.conn.execute(
+            "SELECT mapping, shared_groups, word_limits FROM answer_keys WHERE cam = ? AND section = ? AND test = ?",
+            key_id,
+        ).fetchone()
+        if row is None:
+            return None
+        # JSON object keys are strings; question numbers are ints everywhere else
+        mapping = {int(qnum): answer for qnum, answer in json.loads(row[0]).items()}
+        shared_groups = {int(qnum): group for qnum, group in json.loads(row[1]).items()}
+        word_limits = {int(qnum): WordLimit(*limit) for qnum, limit in json.loads(row[2]).items()}
+        return mapping, shared_groups, word_limits
+
+    def lookup_form(self, section: str, form_name: str
+                    ) -> Optional[Tuple[Dict[int, str], Dict[int, List[int]], Dict[int, WordLimit]]]:
+        """Key for a form named like "Practice Cam 10 Listening Test 01", if imported."""
+        key_id = parse_key_id(form_name)
+        if key_id is None or key_id[1] != section:
+            return None
+        return self.get_key(key_id)
+
+    def count(self) -> int:
+        return self.conn.execute("SELECT COUNT(*) FROM answer_keys").fetchone()[0]
+
+    def import_directory(self, directory: Path) -> Tuple[int, List[str]]:
+        """Import every *.txt key file under directory (recursively).
+
+        A file may hold one test or many; each test is identified by its heading
+        line (e.g. "Cam 10 Listening Test 1"), and a file's first test may
+        instead be named by the file name. Files are streamed, so large
+        multi-test files are never read into memory whole. Returns
+        (imported count, paths of files with tests that could not be identified).
+        """
+        imported = 0
+        skipped: List[str] = []
+
+        def rows():
+            nonlocal imported
+            for path in sorted(Path(directory).rglob("*.txt")):
+                found = False
+                unnamed = False
+                try:
+                    with open(path, "r", encoding="utf-8") as handle:
+                        for index, test in enumerate(iter_answer_tests(handle)):
+                            key_id = parse_key_id(test.heading) or (parse_key_id(path.stem) if index == 0 else None)
+                            if key_id is None:
+                                unnamed = True
+                                continue
+                            found = True
+                            imported += 1
+                            cam, section, test_number = key_id
+                            yield (cam, section, test_number, json.dumps(test.mapping, ensure_ascii=False),
+                                   json.dumps(test.shared_groups), str(path), json.dumps(test.word_limits))
+                except (OSError, UnicodeDecodeError) as e:
+                    print(f"Warning: Could not read key file {path}: {e}")
+                    unnamed = True
+                if unnamed or not found:
+                    skipped.append(str(path))
+
+        with self.conn:
+            self.conn.executemany(
+                "INSERT OR REPLACE INTO answer_keys (cam, section, test, mapping, shared_groups, source, word_limits) "
+                "VALUES (?, ?, ?, ?, ?, ?, ?)",
+                rows(),
+            )
+        return imported, skipped
+
+
+# Journal record fields: one list slot of the form state, the whole state, or its deletion
+JOURNAL_FIELDS = {"u": "user_answers", "k": "answer_keys"}
+JOURNAL_STATE = "s"
+JOURNAL_DELETE = "d"
+
+
+class EditJournal:
+    """Append-only log of form edits made since the last compaction.
+
+    Each record is one compact JSON line, e.g. ["listening:Test 1","u",4,"library"]
+    for "question 5's answer is now 'library'". Records hold absolute values, so
+    replaying a journal that was already compacted is harmless.
+
+    checkpoint() moves the records so far aside to "<path>.N" and starts a
+    fresh file, so edits made while a background save is running are kept;
+    discard(N) deletes the moved files once that save is on disk.
+    """
+
+    def __init__(self, path: Path):
+        self.path = Path(path)
+        self._handle = None
+        segments = self._segments()
+        self._segment = segments[-1][0] if segments else 0  # Number of the newest moved-aside file
+
+    def _append(self, record: list) -> None:
+        if self._handle is None:
+            self._handle = open(self.path, "a", encoding="utf-8")
+            if self._handle.tell() > 0 and not self._ends_with_newline():
+                self._handle.write("\n")  # Start after a torn final record
+        self._handle.write(json.dumps(record, ensure_ascii=False, separators=(",", ":")) + "\n")
+        # Flushed to the OS right away so an app crash keeps the edit
+        self._handle.flush()
+
+    def _ends_with_newline(self) -> bool:
+        with open(self.path, "rb") as f:
+            f.seek(-1, os.SEEK_END)
+            return f.read(1) == b"\n"
+
+    def record_edit(self, form_key: str, field: str, index: int, value: str) -> None:
+        """Record one entry edit; field is "u" (user answer) or "k" (answer key)."""
+        self._append([form_key, field, index, value])
+
+    def record_state(self, form_key: str, state: Dict) -> None:
+        """Record a whole form state (after bulk changes such as pasting a key)."""
+        self._append([form_key, JOURNAL_STATE, state])
+
+    def record_delete(self, form_key: str) -> None:
+        """Record that a form's state was deleted, so replay does not bring back its earlier edits."""
+        self._append([form_key, JOURNAL_DELETE, None])
+
+    def has_records(self) -> bool:
+        """True if edits were recorded since the last checkpoint()."""
+        try:
+            return self.path.stat().st_size > 0
+        except OSError:
+            return False
+
+    def _segments(self) -> List[Tuple[int, Path]]:
+        """Moved-aside journal files as (number, path), oldest first."""
+        segments = []
+        prefix = self.path.name + "."
+        for candidate in self.path.parent.glob(prefix + "*"):
+            suffix = candidate.name[len(prefix):]
+            if suffix.isdecimal():
+                segments.append((int(suffix), candidate))
+        return sorted(segments)
+
+    def replay(self, form_states: Dict[str, Dict]) -> Set[str]:
+        """Apply journaled edits to form_states in place. Returns the changed (or deleted) form keys."""
+        changed: Set[str] = set()
+        for path in [path for _, path in self._segments()] + [self.path]:
+            if path.exists():
+                self._replay_file(path, form_states, changed)
+        return changed
+
+    def _replay_file(self, path: Path, form_states: Dict[str, Dict], changed: Set[str]) -> None:
+        with open(path, "r", encoding="utf-8") as f:
+            for line in f:
+                try:
+                    record = json.loads(line)
+                except json.JSONDecodeError:
+                    continue  # Torn final write after a crash
+                if not isinstance(record, list) or len(record) < 3:
+                    continue
+                form_key, field = record[0], record[1]
+                if field == JOURNAL_STATE:
+                    form_states[form_key] = record[2]
+                elif field == JOURNAL_DELETE:
+                    form_states.pop(form_key, None)
+                elif field in JOURNAL_FIELDS and len(record) == 4 and isinstance(record[2], int) and record[2] >= 0:
+                    index, value = record[2], record[3]
+                    values = form_states.setdefault(form_key, {}).setdefault(JOURNAL_FIELDS[field], [])
+                    if len(values) <= index:
+                        values.extend([""] * (index + 1 - len(values)))
+                    values[index] = value
+                else:
+                    continue
+                changed.add(form_key)
+
+    def checkpoint(self) -> int:
+        """Move the records so far aside and start a new file; returns the mark to discard() later."""
+        self.close()
+        if self.has_records():
+            self._segment += 1
+            os.replace(self.path, self.path.with_name(f"{self.path.name}.{self._segment}"))
+        return self._segment
+
+    def discard(self, mark: int) -> None:
+        """Delete the records moved aside up to checkpoint mark; safe to call from another thread."""
+        for number, path in self._segments():
+            if number > mark:
+                break
+            try:
+                path.unlink()
+            except FileNotFoundError:
+                pass
+
+    def close(self) -> None:
+        if self._handle is not None:
+            self._handle.close()
+            self._handle = None
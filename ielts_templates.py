@@ -0,0 +1,99 @@
+#!/usr/bin/env python3
+"""Test layout templates (no tkinter dependency).
+
+A template describes one kind of answer sheet: its question groups, timer
+and band table. Each lives in templates/<name>.json, e.g.
+
+    {
+      "title": "Reading",               shown in the UI and written to saved answer files
+      "order": 2,                       position on the landing page
+      "featured": true,                 big landing-page button and a pre-built window
+      "timer_minutes": 60,
+      "band_section": "Reading",        band table to use (see ielts_grading.band_table); omit for no band
+      "band_scheme": "academic",        optional, defaults to the table's default scheme
+      "groups": [["Reading Passage 1 (Q1-13)", 13], ...],
+      "window": {"default_width": 1000, "default_height": 700, "min_width": 900, "min_height": 600}
+    }
+
+The folder is read once, on first use, and the parsed templates are cached.
+"""
+
+import json
+import os
+from functools import lru_cache
+from typing import Dict, List, NamedTuple, Optional, Tuple
+
+TEMPLATES_DIR = os.path.join(os.path.dirname(os.path.abspath(__file__)), "templates")
+
+DEFAULT_WINDOW_SIZES = {"default_width": 1000, "default_height": 700, "min_width": 900, "min_height": 600}
+
+
+class TestTemplate(NamedTuple):
+    name: str  # File name without .json; also the section id used for form lists and saved state
+    title: str
+    order: int
+    featured: bool
+    timer_minutes: int
+    band_section: Optional[str]
+    band_scheme: Optional[str]
+    groups: Tuple[Tuple[str, int], ...]  # (column title, question count)
+    window_sizes: Dict[str, int]  # FormWindow size keyword arguments
+
+    @property
+    def question_total(self) -> int:
+        return sum(count for _, count in self.groups)
+
+
+def load_template(path: str) -> TestTemplate:
+    """Parse one template file; raises ValueError naming the file if it is malformed."""
+    name = os.path.splitext(os.path.basename(path))[0]
+    try:
+        with open(path, "r", encoding="utf-8") as handle:
+            data = json.load(handle)
+        groups = tuple((str(title), int(count)) for title, count in data["groups"])
+        if not groups or any(count < 1 for _, count in groups):
+            raise ValueError("groups must list at least one group of one or more questions")
+        window_sizes = dict(DEFAULT_WINDOW_SIZES)
+        window_sizes.update({key: int(value) for key, value in data.get("window", {}).items()
+                             if key in DEFAULT_WINDOW_SIZES})
+        return TestTemplate(
+            name=name,
+            title=str(data.get("title", name)),
+            order=int(data.get("order", 100)),
+            featured=bool(data.get("featured", False)),
+            timer_minutes=int(data["timer_minutes"]),
+            band_section=data.get("band_section"),
+            band_scheme=data.get("band_scheme"),
+            groups=groups,
+            window_sizes=window_sizes,
+        )
+    except (KeyError, TypeError, ValueError) as e:
+        raise ValueError(f"Invalid test template {path}: {e}") from None
+
+
+@lru_cache(maxsize=None)
+def _load_templates(directory: str) -> Tuple[TestTemplate, ...]:
+    paths = [os.path.join(directory, filename) for filename in sorted(os.listdir(directory))
+             if filename.endswith(".json")]
+    return tuple(sorted((load_template(path) for path in paths), key=lambda template: (template.order, template.name)))
+
+
+def all_templates(directory: str = TEMPLATES_DIR) -> List[TestTemplate]:
+    """Every template in the folder, in landing-page order."""
+    return list(_load_templates(directory))
+
+
+def get_template(name: str, directory: str = TEMPLATES_DIR) -> TestTemplate:
+    for template in _load_templates(directory):
+        if template.name == name:
+            return template
+    raise KeyError(f"No test template named {name!r} in {directory}")
+
+
+def template_for_title(title: str, directory: str = TEMPLATES_DIR) -> Optional[TestTemplate]:
+    """The template whose title a saved answer file names (case-insensitive), if any."""
+    title = title.strip().lower()
+    for template in _load_templates(directory):
+        if template.title.lower() == title:
+            return template
+    return None
@@ -0,0 +1,337 @@
+// Compiled grading core for ielts_grading.py.
+//
+// Mirrors py_normalize_answer / py_is_answer_correct / py_match_shared_group
+// exactly. ASCII text (the common case) is normalized in a single pass without
+// touching the regex engine; anything else defers to str.lower() so Unicode
+// case mapping stays identical to the Python path.
+
+#define PY_SSIZE_T_CLEAN
+#include <Python.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+
+using Normalized = std::u32string;
+
+inline bool is_ascii_space(Py_UCS4 ch) {
+    // Same set as str.isspace() / re's \s for the ASCII range.
+    return ch == ' ' || (ch >= 0x09 && ch <= 0x0D) || (ch >= 0x1C && ch <= 0x1F);
+}
+
+// Append the normalized form of text[start:end] to out.
+// Returns false with a Python exception set on failure.
+bool normalize_range(PyObject* text, Py_ssize_t start, Py_ssize_t end, Normalized& out) {
+    out.clear();
+    if (end <= start) {
+        return true;
+    }
+    if (PyUnicode_IS_ASCII(text)) {
+        const Py_UCS1* data = PyUnicode_1BYTE_DATA(text);
+        out.reserve(static_cast<size_t>(end - start));
+        for (Py_ssize_t i = start; i < end; ++i) {
+            Py_UCS4 ch = data[i];
+            if (ch == '-' || is_ascii_space(ch)) {
+                continue;
+            }
+            if (ch >= 'A' && ch <= 'Z') {
+                ch += 'a' - 'A';
+            }
+            out.push_back(static_cast<char32_t>(ch));
+        }
+        return true;
+    }
+
+    // Non-ASCII: let CPython apply full case mapping (final sigma, U+0130, ...)
+    // to exactly the substring the Python code would lower.
+    PyObject* piece = (start == 0 && end == PyUnicode_GET_LENGTH(text))
+                          ? (Py_INCREF(text), text)
+                          : PyUnicode_Substring(text, start, end);
+    if (piece == nullptr) {
+        return false;
+    }
+    PyObject* lowered = PyObject_CallMethod(piece, "lower", nullptr);
+    Py_DECREF(piece);
+    if (lowered == nullptr) {
+        return false;
+    }
+    const int kind = PyUnicode_KIND(lowered);
+    const void* data = PyUnicode_DATA(lowered);
+    const Py_ssize_t length = PyUnicode_GET_LENGTH(lowered);
+    out.reserve(static_cast<size_t>(length));
+    for (Py_ssize_t i = 0; i < length; ++i) {
+        Py_UCS4 ch = PyUnicode_READ(kind, data, i);
+        if (ch == '-' || Py_UNICODE_ISSPACE(ch)) {
+            continue;
+        }
+        out.push_back(static_cast<char32_t>(ch));
+    }
+    Py_DECREF(lowered);
+    return true;
+}
+
+bool normalize(PyObject* text, Normalized& out) {
+    return normalize_range(text, 0, PyUnicode_GET_LENGTH(text), out);
+}
+
+struct Range {
+    Py_ssize_t start;
+    Py_ssize_t end;
+};
+
+// str.split(sep) followed by str.strip() on every piece.
+std::vector<Range> split_stripped(PyObject* text, Py_UCS4 sep) {
+    const int kind = PyUnicode_KIND(text);
+    const void* data = PyUnicode_DATA(text);
+    const Py_ssize_t length = PyUnicode_GET_LENGTH(text);
+
+    std::vector<Range> pieces;
+    Py_ssize_t piece_start = 0;
+    for (Py_ssize_t i = 0; i <= length; ++i) {
+        if (i < length && PyUnicode_READ(kind, data, i) != sep) {
+            continue;
+        }
+        Py_ssize_t start = piece_start;
+        Py_ssize_t end = i;
+        while (start < end && Py_UNICODE_ISSPACE(PyUnicode_READ(kind, data, start))) {
+            ++start;
+        }
+        while (end > start && Py_UNICODE_ISSPACE(PyUnicode_READ(kind, data, end - 1))) {
+            --end;
+        }
+        pieces.push_back({start, end});
+        piece_start = i + 1;
+    }
+    return pieces;
+}
+
+bool check_str(PyObject* obj, const char* name) {
+    if (!PyUnicode_Check(obj)) {
+        PyErr_Format(PyExc_TypeError, "%s must be str, not %.200s", name, Py_TYPE(obj)->tp_name);
+        return false;
+    }
+    return true;
+}
+
+PyObject* native_normalize_answer(PyObject*, PyObject* arg) {
+    if (!check_str(arg, "answer")) {
+        return nullptr;
+    }
+    Normalized out;
+    if (!normalize(arg, out)) {
+        return nullptr;
+    }
+    return PyUnicode_FromKindAndData(PyUnicode_4BYTE_KIND, out.data(), static_cast<Py_ssize_t>(out.size()));
+}
+
+PyObject* native_is_answer_correct(PyObject*, PyObject* const* args, Py_ssize_t nargs) {
+    if (nargs != 2) {
+        PyErr_SetString(PyExc_TypeError, "is_answer_correct() takes exactly 2 arguments");
+        return nullptr;
+    }
+    PyObject* user_answer = args[0];
+    PyObject* key_answer = args[1];
+    if (!check_str(user_answer, "user_answer") || !check_str(key_answer, "key_answer")) {
+        return nullptr;
+    }
+
+    Normalized user_normalized;
+    if (!normalize(user_answer, user_normalized)) {
+        return nullptr;
+    }
+    Normalized option_normalized;
+    for (const Range& option : split_stripped(key_answer, '/')) {
+        if (!normalize_range(key_answer, option.start, option.end, option_normalized)) {
+            return nullptr;
+        }
+        if (option_normalized == user_normalized) {
+            Py_RETURN_TRUE;
+        }
+    }
+    Py_RETURN_FALSE;
+}
+
+// Option sets as bitsets of option indices, one bit per option.
+using OptionMask = std::vector<uint64_t>;
+
+// Index of the lowest set bit of a non-zero word (no compiler builtins, so
+// MSVC builds the same code).
+inline size_t lowest_bit(uint64_t word) {
+    size_t index = 0;
+    while (!(word & 1U)) {
+        word >>= 1;
+        ++index;
+    }
+    return index;
+}
+
+struct GroupMatcher {
+    size_t words;
+    std::vector<OptionMask> answer_masks;  // Options each answer may take
+    OptionMask used;                       // Options taken so far
+    OptionMask seen;                       // Options tried while placing the current answer
+    std::vector<size_t> owner;             // Option -> answer holding it
+
+    GroupMatcher(size_t option_count, std::vector<OptionMask> masks)
+        : words((option_count + 63) / 64),
+          answer_masks(std::move(masks)),
+          used(words, 0),
+          seen(words, 0),
+          owner(option_count, 0) {}
+
+    // Kuhn's augmenting path search, as in _match_options: take a free option
+    // if there is one, otherwise try to move a holder elsewhere. skip is an
+    // option the answer must not take (its current one), or SIZE_MAX.
+    bool place(size_t answer, size_t skip) {
+        const OptionMask& mask = answer_masks[answer];
+        for (size_t w = 0; w < words; ++w) {
+            uint64_t free = mask[w] & ~used[w];
+            if (skip / 64 == w) {
+                free &= ~(uint64_t{1} << (skip % 64));
+            }
+            if (free) {
+                const size_t option = w * 64 + lowest_bit(free);
+                used[w] |= uint64_t{1} << (option % 64);
+                owner[option] = answer;
+                return true;
+            }
+        }
+        OptionMask candidates(words);
+        for (size_t w = 0; w < words; ++w) {
+            candidates[w] = mask[w] & ~seen[w];
+            if (skip / 64 == w) {
+                candidates[w] &= ~(uint64_t{1} << (skip % 64));
+            }
+            seen[w] |= candidates[w];
+        }
+        for (size_t w = 0; w < words; ++w) {
+            for (uint64_t bits = candidates[w]; bits; bits &= bits - 1) {
+                const size_t option = w * 64 + lowest_bit(bits);
+                if (place(owner[option], option)) {
+                    owner[option] = answer;
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+
+    bool match(size_t answer) {
+        std::fill(seen.begin(), seen.end(), 0);
+        for (uint64_t word : answer_masks[answer]) {
+            if (word) {
+                return place(answer, SIZE_MAX);
+            }
+        }
+        return false;
+    }
+};
+
+PyObject* native_match_shared_group(PyObject*, PyObject* const* args, Py_ssize_t nargs) {
+    if (nargs != 2) {
+        PyErr_SetString(PyExc_TypeError, "match_shared_group() takes exactly 2 arguments");
+        return nullptr;
+    }
+    PyObject* key_answer = args[1];
+    if (!check_str(key_answer, "key_answer")) {
+        return nullptr;
+    }
+    PyObject* users = PySequence_Fast(args[0], "user_answers must be a sequence");
+    if (users == nullptr) {
+        return nullptr;
+    }
+
+    // Every listed option counts once, duplicates included; an option accepts
+    // any of its non-blank "/"-separated alternatives.
+    std::vector<Range> options;
+    for (const Range& option : split_stripped(key_answer, ',')) {
+        if (option.end > option.start) {
+            options.push_back(option);
+        }
+    }
+    std::vector<std::vector<Normalized>> alternatives(options.size());
+    for (size_t i = 0; i < options.size(); ++i) {
+        PyObject* option = PyUnicode_Substring(key_answer, options[i].start, options[i].end);
+        if (option == nullptr) {
+            Py_DECREF(users);
+            return nullptr;
+        }
+        Normalized alternative_normalized;
+        for (const Range& alternative : split_stripped(option, '/')) {
+            if (!normalize_range(option, alternative.start, alternative.end, alternative_normalized)) {
+                Py_DECREF(option);
+                Py_DECREF(users);
+                return nullptr;
+            }
+            if (!alternative_normalized.empty()) {
+                alternatives[i].push_back(alternative_normalized);
+            }
+        }
+        Py_DECREF(option);
+    }
+
+    const Py_ssize_t count = PySequence_Fast_GET_SIZE(users);
+    const size_t words = (options.size() + 63) / 64;
+    std::vector<OptionMask> answer_masks(static_cast<size_t>(count), OptionMask(words, 0));
+    Normalized user_normalized;
+    for (Py_ssize_t u = 0; u < count; ++u) {
+        PyObject* user_answer = PySequence_Fast_GET_ITEM(users, u);
+        if (!check_str(user_answer, "user answer") || !normalize(user_answer, user_normalized)) {
+            Py_DECREF(users);
+            return nullptr;
+        }
+        for (size_t i = 0; i < options.size(); ++i) {
+            for (const Normalized& alternative : alternatives[i]) {
+                if (alternative == user_normalized) {
+                    answer_masks[static_cast<size_t>(u)][i / 64] |= uint64_t{1} << (i % 64);
+                    break;
+                }
+            }
+        }
+    }
+    Py_DECREF(users);
+
+    PyObject* verdicts = PyList_New(count);
+    if (verdicts == nullptr) {
+        return nullptr;
+    }
+    GroupMatcher matcher(options.size(), std::move(answer_masks));
+    for (Py_ssize_t u = 0; u < count; ++u) {
+        PyObject* verdict = matcher.match(static_cast<size_t>(u)) ? Py_True : Py_False;
+        Py_INCREF(verdict);
+        PyList_SET_ITEM(verdicts, u, verdict);
+    }
+    return verdicts;
+}
+
+PyMethodDef native_methods[] = {
+    {"normalize_answer", native_normalize_answer, METH_O,
+     "Normalize answers for comparison (case/spacing insensitive)."},
+    {"is_answer_correct", reinterpret_cast<PyCFunction>(reinterpret_cast<void (*)(void)>(native_is_answer_correct)),
+     METH_FASTCALL, "Check if user answer matches any '/'-separated key option."},
+    {"match_shared_group", reinterpret_cast<PyCFunction>(reinterpret_cast<void (*)(void)>(native_match_shared_group)),
+     METH_FASTCALL, "Match a shared group's answers against comma-separated options without replacement (maximum matching)."},
+    {nullptr, nullptr, 0, nullptr},
+};
+
+PyModuleDef native_module = {
+    PyModuleDef_HEAD_INIT,
+    "_ielts_native",
+    "Compiled grading core for ielts_grading.",
+    -1,
+    native_methods,
+    nullptr,
+    nullptr,
+    nullptr,
+    nullptr,
+};
+
+}  // namespace
+
+PyMODINIT_FUNC PyInit__ielts_native(void) {
+    return PyModule_Create(&native_module);
+}
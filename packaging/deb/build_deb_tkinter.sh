@@ -34,7 +34,18 @@ EOF
 APP_SHARE="$STAGE_DIR/usr/share/$APP_ID"
 mkdir -p "$APP_SHARE"
 install -m 644 "$PROJECT_ROOT/ielts_form_tkinter.py" "$APP_SHARE/"
+install -m 644 "$PROJECT_ROOT/ielts_grading.py" "$APP_SHARE/"
+install -m 644 "$PROJECT_ROOT/ielts_canonical.py" "$APP_SHARE/"
+install -m 644 "$PROJECT_ROOT/ielts_cli.py" "$APP_SHARE/"
+install -m 644 "$PROJECT_ROOT/ielts_store.py" "$APP_SHARE/"
+install -m 644 "$PROJECT_ROOT/ielts_model.py" "$APP_SHARE/"
+install -m 644 "$PROJECT_ROOT/ielts_templates.py" "$APP_SHARE/"
+install -m 644 "$PROJECT_ROOT/ielts_form_index.py" "$APP_SHARE/"
 install -m 644 "$PROJECT_ROOT/ielts_icon.png" "$APP_SHARE/"
+install -d "$APP_SHARE/bands"
+install -m 644 "$PROJECT_ROOT"/bands/*.txt "$APP_SHARE/bands/"
+install -d "$APP_SHARE/templates"
+install -m 644 "$PROJECT_ROOT"/templates/*.json "$APP_SHARE/templates/"
 
 # Wrapper script
 BIN_DIR="$STAGE_DIR/usr/bin"
@@ -42,6 +53,10 @@ mkdir -p "$BIN_DIR"
 cat >"$BIN_DIR/$APP_ID" <<'EOF'
 #!/usr/bin/env bash
 set -euo pipefail
+case "${1:-}" in
+  grade|import-keys|history)
+    exec python3 /usr/share/ielts-form-tkinter/ielts_cli.py "$@" ;;
+esac
 exec python3 /usr/share/ielts-form-tkinter/ielts_form_tkinter.py
 EOF
 chmod 755 "$BIN_DIR/$APP_ID"
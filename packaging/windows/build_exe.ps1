@@ -8,6 +8,8 @@ $specName = "IELTSForm"
 # Use tkinter version for Windows (no GTK dependencies needed)
 $mainScript = Join-Path $projectRoot "ielts_form_tkinter.py"
 $iconPath = Join-Path $projectRoot "ielts_icon.png"
+$bandsPath = Join-Path $projectRoot "bands"
+$templatesPath = Join-Path $projectRoot "templates"
 
 if (-not (Test-Path $mainScript)) {
     Write-Error "Cannot find $mainScript. Run this script from the repository."
@@ -24,7 +26,9 @@ $env:PYINSTALLER_CONFIG_DIR = Join-Path $OutputDir "config"
 New-Item -ItemType Directory -Force -Path $env:PYINSTALLER_CONFIG_DIR | Out-Null
 
 $dataArgs = @(
-    "--add-data", "$($iconPath);."
+    "--add-data", "$($iconPath);.",
+    "--add-data", "$($bandsPath);bands",
+    "--add-data", "$($templatesPath);templates"
 )
 
 $pyArgs = @(
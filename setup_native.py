@@ -0,0 +1,26 @@
+#!/usr/bin/env python3
+"""Build the optional compiled grading core used by ielts_grading.py.
+
+    python3 setup_native.py build_ext --inplace
+
+The app works without it; ielts_grading falls back to pure Python.
+"""
+
+import sys
+
+from setuptools import Extension, setup
+
+COMPILE_ARGS = ["/O2", "/std:c++17"] if sys.platform == "win32" else ["-O2", "-std=c++17"]
+
+setup(
+    name="ielts-form-native",
+    version="1.0.0",
+    ext_modules=[
+        Extension(
+            "_ielts_native",
+            sources=["native/ielts_native.cpp"],
+            language="c++",
+            extra_compile_args=COMPILE_ARGS,
+        )
+    ],
+)
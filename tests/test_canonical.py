@@ -0,0 +1,85 @@
+#!/usr/bin/env python3
+"""Canonical spellings used for lenient grading (ielts_canonical)."""
+
+import unittest
+
+from ielts_canonical import canonicalize_answer
+from ielts_grading import compile_answer_key
+
+
+def accepts(key: str, answer: str) -> bool:
+    verdicts, _, _ = compile_answer_key([key]).grade([answer])
+    return bool(verdicts[0])
+
+
+class NumberWordsTest(unittest.TestCase):
+    def test_combined_numbers(self):
+        self.assertEqual(canonicalize_answer("fifteen"), "15")
+        self.assertEqual(canonicalize_answer("twenty-five"), "25")
+        self.assertEqual(canonicalize_answer("one hundred and five"), "105")
+        self.assertEqual(canonicalize_answer("one hundred five"), "105")
+        self.assertEqual(canonicalize_answer("fifteen hundred"), "1500")
+        self.assertEqual(canonicalize_answer("two thousand and twenty"), "2020")
+        self.assertEqual(canonicalize_answer("one million two hundred thousand"), "1200000")
+
+    def test_neighbouring_words_are_separate_numbers(self):
+        self.assertEqual(canonicalize_answer("five six"), "5 6")
+        self.assertEqual(canonicalize_answer("one one"), "1 1")
+        self.assertEqual(canonicalize_answer("twenty twenty"), "20 20")
+        self.assertEqual(canonicalize_answer("nineteen ninety"), "19 90")
+        self.assertEqual(canonicalize_answer("two thousand one thousand"), "2001 thousand")
+
+    def test_wrong_sums_are_not_accepted(self):
+        self.assertFalse(accepts("11", "five six"))
+        self.assertFalse(accepts("2", "one one"))
+        self.assertFalse(accepts("40", "twenty twenty"))
+        self.assertTrue(accepts("105", "one hundred and five"))
+        self.assertTrue(accepts("one hundred and five", "105"))
+
+    def test_trailing_and_is_kept(self):
+        self.assertEqual(canonicalize_answer("one hundred and"), "100 and")
+
+    def test_ordinals(self):
+        self.assertEqual(canonicalize_answer("twenty-first"), "21st")
+        self.assertEqual(canonicalize_answer("second"), "2nd")
+        self.assertEqual(canonicalize_answer("twenty-third"), "23rd")
+        self.assertEqual(canonicalize_answer("eleventh"), "11th")
+        self.assertEqual(canonicalize_answer("twelfth"), "12th")
+        self.assertEqual(canonicalize_answer("one hundred and first"), "101st")
+        self.assertEqual(canonicalize_answer("one hundred and twelfth"), "112th")
+        self.assertTrue(accepts("21st", "twenty-first"))
+        self.assertTrue(accepts("3rd floor", "third floor"))
+        self.assertEqual(canonicalize_answer("the fifteenth of May"), "may 15")
+        self.assertEqual(canonicalize_answer("15th May"), "may 15")
+
+
+class TimesAndMoneyTest(unittest.TestCase):
+    def test_dotted_time_matches_a_time_key(self):
+        self.assertTrue(accepts("3:30", "3.30"))
+        self.assertTrue(accepts("3 pm", "15.00"))
+        self.assertTrue(accepts("3:30 pm", "3.30 pm"))
+        self.assertEqual(canonicalize_answer("3.30 pm"), "15:30")
+
+    def test_bare_decimals_are_not_times(self):
+        self.assertEqual(canonicalize_answer("3.5"), "3.5")
+        self.assertEqual(canonicalize_answer("1.50"), "1.50")
+        self.assertEqual(canonicalize_answer("12.30"), "12.30")
+        self.assertFalse(accepts("1.50", "1:50"))
+        self.assertFalse(accepts("12.30", "12:30"))
+        self.assertFalse(accepts("£1.50", "1:50"))
+
+    def test_currency(self):
+        self.assertEqual(canonicalize_answer("£20.00"), "£20")
+        self.assertEqual(canonicalize_answer("20 quid"), "£20")
+        self.assertTrue(accepts("£20", "20 pounds"))
+        self.assertTrue(accepts("£20", "twenty pounds"))
+        self.assertTrue(accepts("£1", "1 pound"))
+
+    def test_pounds_without_money_are_not_currency(self):
+        self.assertEqual(canonicalize_answer("20 pounds"), "20 pounds")
+        self.assertFalse(accepts("20 pounds", "£20"))
+        self.assertTrue(accepts("20 pounds", "twenty pounds"))
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -0,0 +1,248 @@
+#!/usr/bin/env python3
+"""Answer-key parsing and grading rules (ielts_grading)."""
+
+import itertools
+import random
+import unittest
+
+from ielts_grading import (
+    MAX_KEY_VARIANTS,
+    NEAR_MISS_LONG_LENGTH,
+    NEAR_MISS_MIN_LENGTH,
+    NearForm,
+    WordLimit,
+    _near_form,
+    _within_distance,
+    _key_variants,
+    _match_options,
+    compile_answer_key,
+    compile_answer_text,
+    iter_answer_tests,
+    parse_answer_text,
+    py_match_shared_group,
+)
+
+
+def accepts(key: str, answer: str, word_limit=None) -> bool:
+    verdicts, _, _ = compile_answer_key([key], word_limits={1: word_limit} if word_limit else None).grade([answer])
+    return bool(verdicts[0])
+
+
+class KeyGrammarTest(unittest.TestCase):
+    def test_optional_words(self):
+        self.assertEqual(sorted(_key_variants("(the) library")), ["library", "the library"])
+        self.assertEqual(sorted(_key_variants("(a/the) park")), ["a park", "park", "the park"])
+        self.assertEqual(sorted(_key_variants("bus (station) (car park)")),
+                         ["bus", "bus car park", "bus station", "bus station car park"])
+        self.assertEqual(_key_variants("(library)"), ["library"])  # Never the empty answer
+
+    def test_alternatives_and_optional_words_together(self):
+        for answer in ("library", "the library", "the city library", "city library", "museum"):
+            self.assertTrue(accepts("(the) (city) library / museum", answer), answer)
+        self.assertFalse(accepts("(the) (city) library / museum", "the museum"))
+        self.assertFalse(accepts("(the) library", "a library"))
+        # "/" inside brackets separates optional words, not alternatives
+        self.assertTrue(accepts("(a/the) park", "a park"))
+        self.assertFalse(accepts("(a/the) park", "a"))
+
+    def test_too_many_variants_are_taken_literally(self):
+        key = " ".join("(w%d/x%d)" % (number, number) for number in range(6)) + " end"
+        self.assertGreater(3 ** 6, MAX_KEY_VARIANTS)
+        self.assertEqual(_key_variants(key), [key])
+
+    def test_word_limit_counts(self):
+        self.assertTrue(accepts("(the) old library [2 words]", "old library"))
+        self.assertFalse(accepts("(the) old library [2 words]", "the old library"))
+        self.assertTrue(accepts("(on) 15 May [2 words + number]", "on 15 May"))
+        self.assertFalse(accepts("(on) 15 May [2 words]", "on 15 May"))
+        # A key that breaks its own limit is kept rather than made unanswerable
+        self.assertTrue(accepts("the old library [1 word]", "the old library"))
+
+    def test_limit_words_in_instructions(self):
+        for instruction, limit in (("ONE WORD ONLY", WordLimit(1, False)),
+                                   ("NO MORE THAN THREE WORDS", WordLimit(3, False)),
+                                   ("NO MORE THAN TWO WORDS AND/OR A NUMBER", WordLimit(2, True)),
+                                   ("Write 4 words", WordLimit(4, False))):
+            _, _, word_limits = parse_answer_text(f"{instruction}\n1 park", 1)
+            self.assertEqual(word_limits, {1: limit}, instruction)
+
+
+class WordLimitTest(unittest.TestCase):
+    KEY = """Write NO MORE THAN TWO WORDS AND/OR A NUMBER for each answer.
+1 (the) old library
+2 20 pounds
+3&4 A, C
+Part 2
+5 (the) old library
+"""
+
+    def test_instruction_limit_is_kept_apart_from_the_key_text(self):
+        mapping, shared_groups, word_limits = parse_answer_text(self.KEY, 5)
+        self.assertEqual(mapping[1], "(the) old library")
+        self.assertEqual(word_limits, {1: WordLimit(2, True), 2: WordLimit(2, True)})
+        self.assertEqual(shared_groups[3], [3, 4])
+
+    def test_instruction_limit_is_graded(self):
+        key = compile_answer_text(self.KEY, 5)
+        verdicts, _, _ = key.grade(["the old library", "", "", "", "the old library"])
+        self.assertEqual(verdicts[0], False)  # Three words under a two-word limit
+        self.assertEqual(verdicts[4], True)  # The limit ended at "Part 2"
+        self.assertTrue(accepts("(the) old library", "old library", WordLimit(2, False)))
+
+    def test_typed_limit_replaces_the_instruction(self):
+        self.assertTrue(accepts("(the) old library [3 words]", "the old library", WordLimit(2, False)))
+        self.assertFalse(accepts("(the) old library [2 words]", "the old library"))
+
+
+class AnswerTestBoundaryTest(unittest.TestCase):
+    def test_headings_start_tests(self):
+        text = """Cambridge 12 Listening Test 1
+1 park
+2 B
+Cambridge 12 Listening Test 2
+1 museum
+Cam 12 Reading Test 3
+Passage 1
+1 TRUE
+"""
+        tests = list(iter_answer_tests(text.splitlines()))
+        self.assertEqual([test.heading for test in tests],
+                         ["Cambridge 12 Listening Test 1", "Cambridge 12 Listening Test 2", "Cam 12 Reading Test 3"])
+        self.assertEqual([test.mapping for test in tests], [{1: "park", 2: "B"}, {1: "museum"}, {1: "TRUE"}])
+
+    def test_repeated_question_number_starts_a_test(self):
+        text = "1 park\n2&3 A, C\n1 museum\n3 B\n"
+        tests = list(iter_answer_tests(text.splitlines()))
+        self.assertEqual([test.heading for test in tests], ["", ""])
+        self.assertEqual(tests[0].mapping, {1: "park", 2: "A, C", 3: "A, C"})
+        self.assertEqual(tests[0].shared_groups, {2: [2, 3], 3: [2, 3]})
+        self.assertEqual(tests[1].mapping, {1: "museum", 3: "B"})
+        self.assertEqual(tests[1].shared_groups, {})
+
+    def test_lines_that_do_not_start_a_test(self):
+        text = """Test 1
+(Test 2 is on the next page)
+Questions 1-10
+1 park
+Test 2
+Test 3
+1 museum
+"""
+        tests = list(iter_answer_tests(text.splitlines()))
+        # A bracketed note is not a heading, and a heading without answers yields nothing
+        self.assertEqual([(test.heading, test.mapping) for test in tests],
+                         [("Test 1", {1: "park"}), ("Test 3", {1: "museum"})])
+
+    def test_word_limit_ends_with_the_test(self):
+        text = "Test 1\nONE WORD ONLY\n1 park\nTest 2\n1 city park\n2 zoo\n1 museum\n"
+        tests = list(iter_answer_tests(text.splitlines()))
+        self.assertEqual([test.word_limits for test in tests], [{1: WordLimit(1, False)}, {}, {}])
+
+    def test_same_answers_as_parse_answer_text(self):
+        text = "Part 1\nWrite TWO WORDS\n1 (the) park\n2 B\n21&22 B, D\n40 museum\n"
+        test, = iter_answer_tests(text.splitlines())
+        self.assertEqual((test.mapping, test.shared_groups, test.word_limits), parse_answer_text(text))
+
+    def test_tests_are_yielded_while_reading(self):
+        read = []
+
+        def lines():
+            for line in ("Test 1", "1 park", "Test 2", "1 museum", "Test 3", "1 zoo"):
+                read.append(line)
+                yield line
+
+        tests = iter_answer_tests(lines())
+        self.assertEqual(next(tests).mapping, {1: "park"})
+        self.assertEqual(read, ["Test 1", "1 park", "Test 2"])
+
+
+def levenshtein(a: str, b: str) -> int:
+    previous = list(range(len(b) + 1))
+    for i, ca in enumerate(a, start=1):
+        current = [i]
+        for j, cb in enumerate(b, start=1):
+            current.append(min(previous[j] + 1, current[j - 1] + 1, previous[j - 1] + (ca != cb)))
+        previous = current
+    return previous[-1]
+
+
+class NearMissTest(unittest.TestCase):
+    def test_within_distance_matches_levenshtein(self):
+        rng = random.Random(17)
+        for _ in range(3000):
+            form_text = "".join(rng.choice("abcde") for _ in range(rng.randint(1, 12)))
+            text = "".join(rng.choice("abcde") for _ in range(rng.randint(0, 14)))
+            form = _near_form(form_text)
+            for limit in (0, 1, 2, 3):
+                form = NearForm(form.text, form.char_masks, limit)
+                self.assertEqual(_within_distance(form, text), levenshtein(form_text, text) <= limit,
+                                 (form_text, text, limit))
+
+    def test_threshold_grows_with_key_length(self):
+        short = "a" * (NEAR_MISS_LONG_LENGTH - 1)
+        self.assertEqual(_near_form(short).max_distance, 1)
+        self.assertEqual(_near_form("a" * NEAR_MISS_LONG_LENGTH).max_distance, 2)
+
+        key = compile_answer_key(["library", "accommodation", "park", "B", "15 May"])
+        self.assertTrue(key.near_miss(1, "libary"))  # One edit
+        self.assertFalse(key.near_miss(1, "libraty x"))
+        self.assertFalse(key.near_miss(1, "lbrry"))  # Two edits on a short key
+        self.assertTrue(key.near_miss(2, "acommodaton"))  # Two edits on a long key
+        self.assertFalse(key.near_miss(2, "acomodaton"))  # Three
+        self.assertFalse(key.near_miss(2, ""))
+
+    def test_short_keys_and_numbers_never_near_miss(self):
+        self.assertEqual(len("park"), NEAR_MISS_MIN_LENGTH)
+        key = compile_answer_key(["park", "B", "15 May", "bus"])
+        self.assertTrue(key.near_miss(1, "perk"))  # Exactly the minimum length
+        self.assertFalse(key.near_miss(2, "C"))
+        self.assertFalse(key.near_miss(3, "16 May"))
+        self.assertFalse(key.near_miss(4, "bas"))
+
+    def test_near_miss_is_not_correct(self):
+        verdicts, correct, _ = compile_answer_key(["library"]).grade(["libary"])
+        self.assertEqual((verdicts, correct), ([False], 0))
+
+
+def brute_force_match(answer_masks):
+    """Verdicts of the best assignment found by trying every one: most answers placed, then earliest answers."""
+    options = sorted({bit for mask in answer_masks for bit in range(mask.bit_length()) if mask >> bit & 1})
+
+    def placeable(answers):
+        for picked in itertools.permutations(options, len(answers)):
+            if all(answer_masks[answer] >> option & 1 for answer, option in zip(answers, picked)):
+                return True
+        return False
+
+    best = [False] * len(answer_masks)
+    for size in range(len(answer_masks), 0, -1):
+        found = [answers for answers in itertools.combinations(range(len(answer_masks)), size) if placeable(answers)]
+        if found:
+            # combinations() are in lexicographic order, so the first one favours the earliest answers
+            for answer in found[0]:
+                best[answer] = True
+            break
+    return best
+
+
+class SharedGroupMatchingTest(unittest.TestCase):
+    def test_matches_brute_force(self):
+        rng = random.Random(14)
+        for _ in range(600):
+            option_count = rng.randint(1, 5)
+            masks = [rng.randrange(1 << option_count) if rng.random() < 0.8 else 0
+                     for _ in range(rng.randint(0, 6))]
+            self.assertEqual(_match_options(masks), brute_force_match(masks), masks)
+
+    def test_needs_an_augmenting_path(self):
+        # Answer 0 first takes option 0, and must move to option 1 so answer 1 can score
+        self.assertEqual(_match_options([0b11, 0b01]), [True, True])
+        self.assertEqual(py_match_shared_group(["B", "A"], "A/B, A"), [True, True])
+
+    def test_earlier_answers_win_ties(self):
+        self.assertEqual(_match_options([0b1, 0b1, 0b1]), [True, False, False])
+        self.assertEqual(py_match_shared_group(["A", "A"], "A, B"), [True, False])
+
+
+if __name__ == "__main__":
+    unittest.main()
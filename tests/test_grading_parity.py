@@ -0,0 +1,227 @@
+#!/usr/bin/env python3
+"""The compiled grading core must return exactly what the pure Python code does.
+
+    python3 -m unittest discover tests
+
+The native half is skipped when _ielts_native has not been built
+(python3 setup_native.py build_ext --inplace).
+"""
+
+import random
+import unittest
+from unittest import mock
+
+import ielts_grading
+from ielts_grading import (
+    compile_answer_key,
+    py_is_answer_correct,
+    py_match_shared_group,
+    py_normalize_answer,
+)
+
+try:
+    import _ielts_native  # type: ignore[import-not-found]
+except ImportError:
+    _ielts_native = None
+
+needs_native = unittest.skipIf(_ielts_native is None, "_ielts_native extension is not built")
+
+ANSWERS = [
+    "", " ", "library", " Library ", "LIBRARY", "the library", "the-library", "the  library",
+    "gardens", "gardening", "garden", "B", "b", " d ", "C", "15", "fifteen", "15th May",
+    "Straße", "STRASSE", "İstanbul", "ÉCOLE", "école", "naïve", "tab\there", "x y",
+    "/", "a/b", "a & b", "-", "--", "21&22", "ǅ", "ﬁsh",
+]
+
+KEYS = [
+    "", "library", "gardens / gardening", "gardens/gardening/ garden", "the library / library",
+    "B", "b/ d", "15 / fifteen", "Straße / strasse", "école", "/", " / ", "a/b", "naïve/naive",
+]
+
+GROUP_KEYS = [
+    "B, D", "b,d", "A, B, C", "B/C, D", "B, B", "A/B, A/B", "A, , C", "", ",", "/", "é/E, e",
+    "library, gardens / gardening", "C, D, E",
+]
+
+GROUP_ANSWERS = [
+    ["B", "D"], ["D", "B"], ["B", "B"], ["", "D"], ["", ""], ["C", "B"], ["b", " d "],
+    ["A", "B", "C"], ["C", "B", "A"], ["A", "A", "A"], ["B", "C", "D"], ["É", "e"],
+    ["library", "gardening"], ["gardens", "gardening"], ["E", "D", "C"], ["x"],
+]
+
+
+def _random_text(rng: random.Random) -> str:
+    alphabet = "aAbBcdD /-&,\t é É ß İ ǅ 1 5 "
+    return "".join(rng.choice(alphabet) for _ in range(rng.randint(0, 8)))
+
+
+class PythonGradingTest(unittest.TestCase):
+    """Spot checks of the reference behaviour the native core is held to."""
+
+    def test_normalize_drops_case_spaces_and_hyphens(self):
+        self.assertEqual(py_normalize_answer("  The-Big  Library "), "thebiglibrary")
+
+    def test_slash_alternatives(self):
+        self.assertTrue(py_is_answer_correct("Gardening", "gardens / gardening"))
+        self.assertTrue(py_is_answer_correct("gardens", "gardens / gardening"))
+        self.assertFalse(py_is_answer_correct("garden", "gardens / gardening"))
+
+    def test_shared_group_options_are_used_once(self):
+        self.assertEqual(py_match_shared_group(["B", "D"], "B, D"), [True, True])
+        self.assertEqual(py_match_shared_group(["D", "B"], "B, D"), [True, True])
+        self.assertEqual(py_match_shared_group(["B", "B"], "B, D"), [True, False])
+        self.assertEqual(py_match_shared_group(["", "D"], "B, D"), [False, True])
+
+    def test_shared_group_finds_best_assignment(self):
+        # Whichever answer comes first, "C" ends up on the second option so "B" can score
+        self.assertEqual(py_match_shared_group(["B", "C"], "B/C, C"), [True, True])
+        self.assertEqual(py_match_shared_group(["C", "B"], "B/C, C"), [True, True])
+
+
+@needs_native
+class NativeParityTest(unittest.TestCase):
+    def test_normalize_answer(self):
+        for answer in ANSWERS + KEYS:
+            with self.subTest(answer=answer):
+                self.assertEqual(_ielts_native.normalize_answer(answer), py_normalize_answer(answer))
+
+    def test_is_answer_correct(self):
+        for key in KEYS:
+            for answer in ANSWERS:
+                with self.subTest(answer=answer, key=key):
+                    self.assertEqual(_ielts_native.is_answer_correct(answer, key),
+                                     py_is_answer_correct(answer, key))
+
+    def test_match_shared_group(self):
+        for key in GROUP_KEYS:
+            for answers in GROUP_ANSWERS:
+                with self.subTest(answers=answers, key=key):
+                    self.assertEqual(_ielts_native.match_shared_group(answers, key),
+                                     py_match_shared_group(answers, key))
+
+    def test_random_inputs(self):
+        rng = random.Random(20240601)
+        for _ in range(5000):
+            answer, key = _random_text(rng), _random_text(rng)
+            self.assertEqual(_ielts_native.normalize_answer(answer), py_normalize_answer(answer), answer)
+            self.assertEqual(_ielts_native.is_answer_correct(answer, key), py_is_answer_correct(answer, key),
+                             (answer, key))
+            answers = [_random_text(rng) for _ in range(rng.randint(1, 4))]
+            self.assertEqual(_ielts_native.match_shared_group(answers, key), py_match_shared_group(answers, key),
+                             (answers, key))
+
+
+def _python_grade(answer_keys, shared_groups, answers):
+    """CompiledKey.grade with ielts_grading forced onto the pure Python functions."""
+    with mock.patch.object(ielts_grading, "normalize_answer", py_normalize_answer):
+        return compile_answer_key(answer_keys, shared_groups).grade(answers)
+
+
+class CompiledKeyTest(unittest.TestCase):
+    ANSWER_KEYS = ["library", "gardens / gardening", "B, D", "", "(the) park", "15th May", "Straße"]
+    SHARED_GROUPS = {3: [3, 4]}
+
+    def test_grade_matches_reference_functions(self):
+        answers = ["Library", "gardening", "D", "B", "the park", "May 15", "STRAßE"]
+        verdicts, correct, evaluated = _python_grade(self.ANSWER_KEYS, self.SHARED_GROUPS, answers)
+        self.assertEqual(verdicts, [True, True, True, True, True, True, True])
+        self.assertEqual((correct, evaluated), (7, 7))
+        self.assertEqual(verdicts[2:4], py_match_shared_group(answers[2:4], self.ANSWER_KEYS[2]))
+
+    def test_unkeyed_questions_get_no_verdict(self):
+        verdicts, correct, evaluated = _python_grade(["", "a"], {}, ["x", "b"])
+        self.assertEqual(verdicts, [None, False])
+        self.assertEqual((correct, evaluated), (0, 1))
+
+    def test_grade_unit_sums_to_grade(self):
+        answers = ["x", "gardens", "B", "B", "park", "", "strasse"]
+        key = compile_answer_key(self.ANSWER_KEYS, self.SHARED_GROUPS)
+        merged = [None] * len(self.ANSWER_KEYS)
+        correct = evaluated = 0
+        for unit in range(key.unit_count()):
+            unit_verdicts, unit_correct, unit_evaluated = key.grade_unit(unit, answers)
+            for qnum, verdict in zip(key.unit_members(unit), unit_verdicts):
+                merged[qnum - 1] = verdict
+            correct += unit_correct
+            evaluated += unit_evaluated
+        self.assertEqual((merged, correct, evaluated), key.grade(answers))
+
+    @needs_native
+    def test_native_grade_matches_python(self):
+        self.assertTrue(ielts_grading.HAVE_NATIVE)
+        rng = random.Random(7)
+        for _ in range(300):
+            answers = [rng.choice(ANSWERS + ["B", "D", "park", "the park"]) for _ in self.ANSWER_KEYS]
+            native = compile_answer_key(self.ANSWER_KEYS, self.SHARED_GROUPS).grade(answers)
+            self.assertEqual(native, _python_grade(self.ANSWER_KEYS, self.SHARED_GROUPS, answers), answers)
+
+
+# Words canonicalize_answer leaves alone, so compiled keys accept exactly what the reference functions do
+PLAIN_WORDS = ["B", "b", " D", "d", "C", "library", "Library ", "the library", "garden", "gardens", "x y", ""]
+
+
+def _random_key(rng: random.Random, question_total: int):
+    """Random answer keys and shared groups (plain words, alternatives and "choose two" groups)."""
+    answer_keys, shared_groups = [], {}
+    qnum = 1
+    while qnum <= question_total:
+        if qnum < question_total and rng.random() < 0.3:
+            options = ", ".join(rng.choice(PLAIN_WORDS[:-1]) for _ in range(2))
+            answer_keys += [options, options]
+            shared_groups[qnum] = shared_groups[qnum + 1] = [qnum, qnum + 1]
+            qnum += 2
+            continue
+        answer_keys.append(" / ".join(rng.choice(PLAIN_WORDS) for _ in range(rng.randint(1, 2))))
+        qnum += 1
+    return answer_keys, shared_groups
+
+
+def _reference_grade(answer_keys, shared_groups, answers):
+    """What evaluate() did before keys were compiled: one is_answer_correct or match_shared_group call each."""
+    verdicts = [None] * len(answer_keys)
+    for index, key in enumerate(answer_keys):
+        qnum = index + 1
+        if qnum in shared_groups:
+            if qnum == shared_groups[qnum][0]:
+                members = shared_groups[qnum]
+                group_verdicts = ielts_grading.match_shared_group([answers[q - 1] for q in members], key)
+                for member, verdict in zip(members, group_verdicts):
+                    verdicts[member - 1] = verdict
+        elif key.strip():
+            verdicts[index] = ielts_grading.is_answer_correct(answers[index], key)
+    return verdicts
+
+
+class CompiledPathParityTest(unittest.TestCase):
+    """The compiled matching path against the per-question functions it replaced, in either build."""
+
+    def test_grade_matches_per_question_functions(self):
+        rng = random.Random(2)
+        for _ in range(500):
+            answer_keys, shared_groups = _random_key(rng, rng.randint(1, 8))
+            answers = [rng.choice(PLAIN_WORDS) for _ in answer_keys]
+            verdicts, correct, evaluated = compile_answer_key(answer_keys, shared_groups).grade(answers)
+            expected = _reference_grade(answer_keys, shared_groups, answers)
+            self.assertEqual(verdicts, expected, (answer_keys, shared_groups, answers))
+            self.assertEqual(correct, sum(1 for verdict in expected if verdict))
+            self.assertEqual(evaluated, sum(1 for verdict in expected if verdict is not None))
+
+    @needs_native
+    def test_native_matches_python_on_random_keys(self):
+        rng = random.Random(3)
+        for _ in range(500):
+            answer_keys, shared_groups = _random_key(rng, rng.randint(1, 8))
+            answer_keys = [key if rng.random() < 0.7 else _random_text(rng) for key in answer_keys]
+            answers = [rng.choice(PLAIN_WORDS) if rng.random() < 0.7 else _random_text(rng) for _ in answer_keys]
+            native_key = compile_answer_key(answer_keys, shared_groups)
+            with mock.patch.object(ielts_grading, "normalize_answer", py_normalize_answer):
+                python_key = compile_answer_key(answer_keys, shared_groups)
+                python_near = [python_key.near_miss(qnum, answer) for qnum, answer in enumerate(answers, start=1)]
+            self.assertEqual(native_key.grade(answers), _python_grade(answer_keys, shared_groups, answers),
+                             (answer_keys, answers))
+            self.assertEqual([native_key.near_miss(qnum, answer) for qnum, answer in enumerate(answers, start=1)],
+                             python_near, (answer_keys, answers))
+
+
+if __name__ == "__main__":
+    unittest.main()
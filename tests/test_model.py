@@ -0,0 +1,87 @@
+#!/usr/bin/env python3
+"""Section data and live grading (ielts_model)."""
+
+import random
+import unittest
+
+from ielts_grading import parse_answer_text
+from ielts_model import FIELD_SCORE, SectionModel
+
+KEY = """1 (the) library
+2 B
+3&4 A, C
+5&6&7 B, D, E
+8 15th May
+9 3 pm / 15:00
+10 B/C, D
+"""
+CHOICES = ["", "library", "the library", "librery", "A", "B", "C", "D", "E", "may 15", "15:00", "x"]
+
+
+class ResizeTest(unittest.TestCase):
+    def test_resize_drops_live_grading_state(self):
+        model = SectionModel(3)
+        model.apply_answer_keys({1: "library", 2: "park", 3: "B"})
+        model.set_live_grading(True)
+        model.resize(5)
+        self.assertFalse(model.live_grading)
+        self.assertIsNone(model.score)
+        # Editing after a resize must not use unit indexes from the old key
+        model.set_answer(0, "library")
+        self.assertEqual(model.verdicts, [None] * 5)
+        model.set_key(0, "library")
+        self.assertEqual(model.evaluate(), (1, 1))
+
+
+class LiveGradingTest(unittest.TestCase):
+    def test_edits_match_a_full_evaluate(self):
+        rng = random.Random(13)
+        live = SectionModel(10)
+        live.apply_answer_keys(*parse_answer_text(KEY, 10))
+        scores = []
+        live.listeners.append(lambda field, index: field == FIELD_SCORE and scores.append(live.score))
+        live.set_live_grading(True)
+        for step in range(400):
+            index = rng.randrange(10)
+            if step % 50 == 49:
+                live.set_key(index, rng.choice(CHOICES))  # A key edit re-grades everything
+            else:
+                live.set_answer(index, rng.choice(CHOICES))
+
+            full = SectionModel(10)
+            full.apply_answer_keys(*parse_answer_text(KEY, 10))
+            for question in range(10):
+                full.set_key(question, live.key(question))
+                full.set_answer(question, live.answer(question))
+            score = full.evaluate()
+            self.assertEqual(live.verdicts, full.verdicts, step)
+            self.assertEqual(live.near_misses, full.near_misses, step)
+            self.assertEqual(live.score, score, step)
+        self.assertEqual(scores[-1], live.score)
+
+    def test_bulk_change_grades_once(self):
+        model = SectionModel(10)
+        model.apply_answer_keys(*parse_answer_text(KEY, 10))
+        model.set_live_grading(True)
+        scores = []
+        model.listeners.append(lambda field, index: field == FIELD_SCORE and scores.append(model.score))
+        with model.bulk_change():
+            model.set_answer(0, "library")
+            model.set_answer(1, "B")
+            self.assertEqual(scores, [])
+        self.assertEqual(scores, [(2, 10)])
+
+    def test_turning_live_grading_off_keeps_verdicts(self):
+        model = SectionModel(10)
+        model.apply_answer_keys(*parse_answer_text(KEY, 10))
+        model.set_answer(0, "library")
+        model.set_live_grading(True)
+        model.set_live_grading(False)
+        self.assertIsNone(model.score)
+        self.assertTrue(model.verdicts[0])
+        model.set_answer(0, "x")
+        self.assertTrue(model.verdicts[0])  # No longer graded as it is typed
+
+
+if __name__ == "__main__":
+    unittest.main()
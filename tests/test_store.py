@@ -0,0 +1,313 @@
+#!/usr/bin/env python3
+"""Form database, background writer and edit journal (ielts_store)."""
+
+import contextlib
+import io
+import json
+import os
+import sqlite3
+import tempfile
+import threading
+import time
+import unittest
+from unittest import mock
+
+import ielts_store
+from ielts_store import Attempt, EditJournal, FormStore, StoreWriter, apply_delta, diff_state
+
+
+def sample_state(answer: str = "library") -> dict:
+    return {"user_answers": [answer, ""], "answer_keys": ["library", "B"], "shared_groups": {}}
+
+
+class StoreTestCase(unittest.TestCase):
+    def setUp(self):
+        self._dir = tempfile.TemporaryDirectory(prefix="ielts-test-")
+        self.addCleanup(self._dir.cleanup)
+        self.path = os.path.join(self._dir.name, "forms.sqlite3")
+
+    def load_states(self) -> dict:
+        store = FormStore(self.path)
+        try:
+            return store.load_states()
+        finally:
+            store.close()
+
+
+class FormStoreTest(StoreTestCase):
+    def test_apply_changes_round_trip(self):
+        store = FormStore(self.path)
+        written = store.apply_changes(
+            {"listening:Test 1": sample_state(), "reading:Test 1": sample_state("park")},
+            {"listening": ["Test 1", "Test 2"], "reading": ["Test 1"]},
+        )
+        self.assertEqual(written, 2)
+        store.close()
+
+        store = FormStore(self.path)
+        self.addCleanup(store.close)
+        self.assertEqual(store.load_states(), {
+            "listening:Test 1": sample_state(),
+            "reading:Test 1": sample_state("park"),
+        })
+        self.assertEqual(store.load_forms("listening"), ["Test 1", "Test 2"])
+        self.assertEqual(store.load_forms("reading"), ["Test 1"])
+
+    def test_unchanged_rows_are_skipped(self):
+        store = FormStore(self.path)
+        self.addCleanup(store.close)
+        store.apply_changes({"listening:Test 1": sample_state()}, {"listening": ["Test 1"]})
+        self.assertEqual(store.apply_changes({"listening:Test 1": sample_state()}, {"listening": ["Test 1"]}), 0)
+        self.assertFalse(store.put_state("listening:Test 1", sample_state()))
+        self.assertTrue(store.put_state("listening:Test 1", sample_state("park")))
+        self.assertFalse(store.set_forms("listening", ["Test 1"]))
+
+    def test_none_deletes_a_state(self):
+        store = FormStore(self.path)
+        self.addCleanup(store.close)
+        store.apply_changes({"listening:Test 1": sample_state(), "listening:Test 2": sample_state()}, {})
+        self.assertEqual(store.apply_changes({"listening:Test 1": None}, {"listening": ["Test 2"]}), 1)
+        self.assertEqual(set(store.load_states()), {"listening:Test 2"})
+        self.assertIsNone(store.get_state("listening:Test 1"))
+        self.assertEqual(store.load_forms("listening"), ["Test 2"])
+
+    def test_migrates_forms_json_once(self):
+        legacy = os.path.join(self._dir.name, "forms.json")
+        with open(legacy, "w", encoding="utf-8") as handle:
+            json.dump({"listening_forms": ["Test 1"], "reading_forms": [],
+                       "form_states": {"listening:Test 1": sample_state()}}, handle)
+        store = FormStore(self.path, legacy_json=legacy)
+        self.assertEqual(store.load_states(), {"listening:Test 1": sample_state()})
+        self.assertEqual(store.load_forms("listening"), ["Test 1"])
+        store.apply_changes({"listening:Test 1": None}, {"listening": []})
+        store.close()
+
+        store = FormStore(self.path, legacy_json=legacy)  # Already imported: not read again
+        self.addCleanup(store.close)
+        self.assertEqual(store.load_states(), {})
+        self.assertEqual(store.load_forms("listening"), [])
+
+
+class KeySetTest(StoreTestCase):
+    V1_SCHEMA = """
+    CREATE TABLE meta (key TEXT PRIMARY KEY, value TEXT NOT NULL);
+    CREATE TABLE forms (section TEXT NOT NULL, name TEXT NOT NULL, position INTEGER NOT NULL,
+                        PRIMARY KEY (section, name));
+    CREATE TABLE form_states (form_key TEXT PRIMARY KEY, state TEXT NOT NULL);
+    INSERT INTO meta (key, value) VALUES ('schema_version', '1');
+    """
+
+    def key_set_count(self, store: FormStore) -> int:
+        return store.conn.execute("SELECT COUNT(*) FROM answer_key_sets").fetchone()[0]
+
+    def test_forms_with_the_same_keys_share_one_row(self):
+        store = FormStore(self.path)
+        self.addCleanup(store.close)
+        store.apply_changes({f"listening:Test {number}": sample_state(str(number)) for number in range(5)}, {})
+        self.assertEqual(self.key_set_count(store), 1)
+        self.assertEqual(store.forms_with_key(["library", "B"]), [f"listening:Test {number}" for number in range(5)])
+
+        states = store.load_states()
+        states["listening:Test 0"]["answer_keys"][0] = "changed"  # Each state gets a list of its own
+        self.assertEqual(states["listening:Test 1"]["answer_keys"], ["library", "B"])
+
+    def test_unused_key_sets_are_dropped(self):
+        store = FormStore(self.path)
+        self.addCleanup(store.close)
+        other = dict(sample_state(), answer_keys=["park", "C"])
+        store.apply_changes({"listening:Test 1": sample_state(), "listening:Test 2": sample_state()}, {})
+        store.apply_changes({"listening:Test 1": other}, {})
+        self.assertEqual(self.key_set_count(store), 2)  # Test 2 still uses the first list
+        store.apply_changes({"listening:Test 2": None}, {})
+        self.assertEqual(self.key_set_count(store), 1)
+        self.assertEqual(store.forms_with_key(["library", "B"]), [])
+        self.assertEqual(store.load_states(), {"listening:Test 1": other})
+
+    def test_upgrade_from_version_1(self):
+        conn = sqlite3.connect(self.path)
+        conn.executescript(self.V1_SCHEMA)
+        with conn:
+            conn.executemany("INSERT INTO form_states (form_key, state) VALUES (?, ?)", [
+                ("listening:Test 1", json.dumps(sample_state())),
+                ("listening:Test 2", json.dumps(sample_state("park"))),
+                ("reading:Test 1", "{not json"),
+            ])
+        conn.close()
+
+        store = FormStore(self.path)
+        self.addCleanup(store.close)
+        self.assertEqual(store._get_meta("schema_version"), str(ielts_store.SCHEMA_VERSION))
+        self.assertEqual(self.key_set_count(store), 1)
+        self.assertEqual(store.forms_with_key(["library", "B"]), ["listening:Test 1", "listening:Test 2"])
+        with contextlib.redirect_stdout(io.StringIO()):  # The unreadable row is reported and skipped
+            self.assertEqual(store.load_states(), {
+                "listening:Test 1": sample_state(),
+                "listening:Test 2": sample_state("park"),
+            })
+
+
+class AttemptHistoryTest(StoreTestCase):
+    def attempt_state(self, number: int) -> dict:
+        """A state that changes a little from one attempt to the next."""
+        answers = [f"answer {slot}" for slot in range(38 + number % 3)]  # Grows and shrinks
+        answers[number % 38] = f"changed {number}"
+        state = {"user_answers": answers, "answer_keys": [f"key {slot}" for slot in range(40)],
+                 "score_text": f"{number}/40"}
+        if number % 5 == 0:
+            state["submitted_score"] = [number % 7, 6]  # Appears and is dropped again
+        return state
+
+    def test_diff_and_apply_round_trip(self):
+        for old_number in range(12):
+            for new_number in range(12):
+                old, new = self.attempt_state(old_number), self.attempt_state(new_number)
+                self.assertEqual(apply_delta(old, diff_state(old, new)), new)
+        old = self.attempt_state(3)
+        apply_delta(old, diff_state(old, self.attempt_state(4)))
+        self.assertEqual(old, self.attempt_state(3))  # Not modified
+
+    def test_attempts_rebuild_across_snapshots(self):
+        store = FormStore(self.path)
+        for number in range(1, 24):
+            attempt = Attempt("listening:Test 1", f"2026-01-01T10:{number:02d}:00", number % 7, 6,
+                              self.attempt_state(number))
+            if number % 2:
+                self.assertEqual(store.add_attempt(attempt), number)
+            else:
+                store.apply_changes({}, {}, [attempt])
+            if number == 15:
+                store.close()
+                store = FormStore(self.path)  # Later deltas are made against a state read back from disk
+        self.addCleanup(store.close)
+
+        full = [number for number, is_full in store.conn.execute(
+            "SELECT number, full FROM attempts WHERE form_key = ? ORDER BY number", ("listening:Test 1",)) if is_full]
+        self.assertEqual(full, [1, 11, 21])  # The rest are deltas
+        self.assertEqual([row[0] for row in store.list_attempts("listening:Test 1")], list(range(1, 24)))
+        for number in range(1, 24):
+            self.assertEqual(store.get_attempt("listening:Test 1", number), self.attempt_state(number))
+        self.assertIsNone(store.get_attempt("listening:Test 1", 24))
+
+    def test_deleting_a_form_deletes_its_history(self):
+        store = FormStore(self.path)
+        self.addCleanup(store.close)
+        store.apply_changes({"listening:Test 1": sample_state()}, {},
+                            [Attempt("listening:Test 1", "2026-01-01T10:00:00", 1, 2, sample_state())])
+        store.apply_changes({"listening:Test 1": None}, {},
+                            [Attempt("listening:Test 1", "2026-01-01T11:00:00", 2, 2, sample_state("park"))])
+        # The history restarts at 1, from a full snapshot
+        self.assertEqual(store.list_attempts("listening:Test 1"), [(1, "2026-01-01T11:00:00", 2, 2)])
+        self.assertEqual(store.get_attempt("listening:Test 1", 1), sample_state("park"))
+
+
+class StoreWriterTest(StoreTestCase):
+    def test_writes_submitted_states(self):
+        writer = StoreWriter(self.path)
+        writer.submit({"listening:Test 1": sample_state()}, {"listening": ["Test 1"]})
+        self.assertTrue(writer.close(5.0))
+        self.assertEqual(self.load_states()["listening:Test 1"]["user_answers"], ["library", ""])
+
+    def test_unexpected_error_keeps_the_thread_retrying(self):
+        output = io.StringIO()
+        with mock.patch.object(ielts_store, "WRITE_RETRY_SECONDS", 0.01), \
+                mock.patch.object(FormStore, "apply_changes", side_effect=RuntimeError("boom")), \
+                contextlib.redirect_stdout(output):
+            writer = StoreWriter(self.path)
+            writer.submit({"listening:Test 1": sample_state()}, {})
+            self.assertFalse(writer.flush(5.0))
+            self.assertIsInstance(writer.failure, RuntimeError)
+            time.sleep(0.1)  # Several retries
+            started = time.monotonic()
+            self.assertFalse(writer.close(5.0))
+            self.assertLess(time.monotonic() - started, 5.0)
+            states, _, _, _ = writer.take_pending()
+        self.assertIn("listening:Test 1", states)
+        # One warning for the whole failing streak, not one per retry
+        self.assertEqual(output.getvalue().count("Could not save database"), 1)
+
+    def test_take_pending_returns_a_hung_write(self):
+        release = threading.Event()
+        started = threading.Event()
+
+        def hang(*_args):
+            started.set()
+            release.wait(5.0)
+            return 0
+
+        self.addCleanup(release.set)
+        with mock.patch.object(FormStore, "apply_changes", side_effect=hang):
+            writer = StoreWriter(self.path)
+            writer.submit({"listening:Test 1": sample_state()}, {}, on_written=lambda: None)
+            self.assertTrue(started.wait(5.0))
+            writer.submit({"listening:Test 2": sample_state("park")}, {})
+            self.assertFalse(writer.close(0.05))
+            states, _, _, callbacks = writer.take_pending()
+        self.assertEqual(set(states), {"listening:Test 1", "listening:Test 2"})
+        self.assertEqual(len(callbacks), 1)
+
+
+
+class EditJournalTest(StoreTestCase):
+    def setUp(self):
+        super().setUp()
+        self.journal = EditJournal(os.path.join(self._dir.name, "forms.journal"))
+        self.addCleanup(self.journal.close)
+
+    def test_replay_applies_edits_states_and_deletes(self):
+        self.journal.record_edit("listening:Test 1", "u", 1, "park")
+        self.journal.record_edit("listening:Test 2", "k", 3, "B")
+        self.journal.record_state("reading:Test 1", sample_state())
+        self.journal.record_edit("reading:Test 2", "u", 0, "gone")
+        self.journal.record_delete("reading:Test 2")
+        states = {"listening:Test 1": sample_state()}
+
+        changed = self.journal.replay(states)
+
+        self.assertEqual(changed, {"listening:Test 1", "listening:Test 2", "reading:Test 1", "reading:Test 2"})
+        self.assertEqual(states["listening:Test 1"]["user_answers"], ["library", "park"])
+        self.assertEqual(states["listening:Test 2"], {"answer_keys": ["", "", "", "B"]})
+        self.assertEqual(states["reading:Test 1"], sample_state())
+        self.assertNotIn("reading:Test 2", states)
+
+    def test_replay_skips_a_torn_last_record(self):
+        self.journal.record_edit("listening:Test 1", "u", 0, "park")
+        self.journal.close()
+        with open(self.journal.path, "a", encoding="utf-8") as handle:
+            handle.write('["listening:Test 1","u",0,"ca')  # The app died mid-write
+        self.journal.record_edit("listening:Test 1", "u", 1, "bus")  # Starts on a new line
+        states = {}
+        self.journal.replay(states)
+        self.assertEqual(states["listening:Test 1"]["user_answers"], ["park", "bus"])
+
+    def test_checkpoint_keeps_later_edits_until_discarded(self):
+        self.journal.record_edit("listening:Test 1", "u", 0, "park")
+        mark = self.journal.checkpoint()
+        self.assertFalse(self.journal.has_records())
+        self.journal.record_edit("listening:Test 1", "u", 0, "bus")  # Made while the save is running
+
+        states = {}
+        self.journal.replay(states)
+        self.assertEqual(states["listening:Test 1"]["user_answers"], ["bus"])  # Moved-aside records first
+
+        self.journal.discard(mark)
+        states = {}
+        self.assertEqual(self.journal.replay(states), {"listening:Test 1"})
+        self.assertEqual(states["listening:Test 1"]["user_answers"], ["bus"])
+        self.assertEqual(self.journal.checkpoint(), mark + 1)
+        self.journal.discard(mark + 1)
+        self.assertEqual(self.journal.replay({}), set())
+
+    def test_checkpoint_numbers_survive_a_restart(self):
+        self.journal.record_edit("listening:Test 1", "u", 0, "park")
+        mark = self.journal.checkpoint()
+        reopened = EditJournal(self.journal.path)
+        self.addCleanup(reopened.close)
+        reopened.record_edit("listening:Test 1", "u", 0, "bus")
+        self.assertEqual(reopened.checkpoint(), mark + 1)
+        states = {}
+        reopened.replay(states)
+        self.assertEqual(states["listening:Test 1"]["user_answers"], ["bus"])
+
+
+if __name__ == "__main__":
+    unittest.main()